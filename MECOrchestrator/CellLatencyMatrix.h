@@ -0,0 +1,89 @@
+#ifndef __SIMU5G_CELLLATENCYMATRIX_H_
+#define __SIMU5G_CELLLATENCYMATRIX_H_
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace simu5g {
+
+/**
+ * CellLatencyMatrix
+ *
+ * Latency between every cell (base station) and every MEC host, stored in a single
+ * flat array with one row per host: latency_[host * numCells + cell]. Rows are
+ * index-aligned with the MecHostRegistry and follow its membership changes:
+ *
+ *  - addHost() appends a row of unknown entries, O(cells)
+ *  - removeHost() moves the last row into the removed one, as the registry does, O(cells)
+ *  - setNumCells() re-lays out the array; it is meant for the (rare) discovery of a cell
+ *
+ * Lookups are a single array access. Unknown entries (no path, or not computed yet)
+ * are NaN.
+ *
+ * The class does not depend on OMNeT++.
+ */
+class CellLatencyMatrix
+{
+  protected:
+    std::vector<double> latency_;
+    int numHosts_ = 0;
+    int numCells_ = 0;
+
+  public:
+    static double unknown() { return std::numeric_limits<double>::quiet_NaN(); }
+
+    int getNumHosts() const { return numHosts_; }
+    int getNumCells() const { return numCells_; }
+
+    void addHost()
+    {
+        latency_.resize((size_t)(numHosts_ + 1) * numCells_, unknown());
+        ++numHosts_;
+    }
+
+    void removeHost(int host)
+    {
+        int last = numHosts_ - 1;
+        if (host != last) {
+            for (int cell = 0; cell < numCells_; ++cell)
+                latency_[(size_t)host * numCells_ + cell] = latency_[(size_t)last * numCells_ + cell];
+        }
+        latency_.resize((size_t)last * numCells_);
+        --numHosts_;
+    }
+
+    void setNumCells(int numCells)
+    {
+        if (numCells == numCells_)
+            return;
+        std::vector<double> latency((size_t)numHosts_ * numCells, unknown());
+        for (int host = 0; host < numHosts_; ++host) {
+            for (int cell = 0; cell < numCells && cell < numCells_; ++cell)
+                latency[(size_t)host * numCells + cell] = latency_[(size_t)host * numCells_ + cell];
+        }
+        latency_.swap(latency);
+        numCells_ = numCells;
+    }
+
+    // marks all the entries of a host as unknown
+    void clearHost(int host)
+    {
+        for (int cell = 0; cell < numCells_; ++cell)
+            latency_[(size_t)host * numCells_ + cell] = unknown();
+    }
+
+    void set(int cell, int host, double latency) { latency_[(size_t)host * numCells_ + cell] = latency; }
+
+    // NaN if unknown; cell must be in [0, getNumCells())
+    double get(int cell, int host) const { return latency_[(size_t)host * numCells_ + cell]; }
+
+    bool contains(int cell, int host) const
+    {
+        return cell >= 0 && cell < numCells_ && !std::isnan(get(cell, host));
+    }
+};
+
+} // namespace simu5g
+
+#endif  // __SIMU5G_CELLLATENCYMATRIX_H_
@@ -0,0 +1,175 @@
+#ifndef __SIMU5G_HOSTFEASIBILITYINDEX_H_
+#define __SIMU5G_HOSTFEASIBILITYINDEX_H_
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace simu5g {
+
+/**
+ * HostFeasibilityIndex
+ *
+ * Which MEC hosts can allocate a given amount of RAM, disk and CPU, as bitsets over the
+ * registry indices. Every distinct amount requested for a resource is a class, holding
+ * the bitset of the hosts with more of that resource available (the strict test of
+ * VirtualisationInfrastructureManager::isAllocable()). The hosts that can allocate a
+ * request are the AND of the bitsets of its three classes, 64 hosts per word, so the
+ * hosts that cannot allocate it are never looked at.
+ *
+ *  - setAvailable() updates the bits of a host in every class, O(classes)
+ *  - a class is created on the first request of its amount, O(hosts)
+ *  - addHost() and removeHost() follow the registry (removal moves the last host)
+ *
+ * The number of classes is bounded by the resource amounts of the onboarded application
+ * descriptors.
+ *
+ * The class does not depend on OMNeT++.
+ */
+class HostFeasibilityIndex
+{
+  public:
+    enum Resource { RAM, DISK, CPU, NUM_RESOURCES };
+
+    // a set of hosts, one bit per registry index
+    struct HostSet
+    {
+        std::vector<uint64_t> words;
+
+        bool contains(int host) const { return (words[host >> 6] >> (host & 63)) & 1; }
+
+        // first host of the set with index >= from, -1 if none; skips empty words
+        int next(int from) const
+        {
+            std::size_t w = unsigned(from) >> 6;
+            if (w >= words.size())
+                return -1;
+            if (uint64_t bits = words[w] >> (from & 63))
+                return from + __builtin_ctzll(bits);
+            while (++w < words.size()) {
+                if (words[w])
+                    return int(w * 64 + __builtin_ctzll(words[w]));
+            }
+            return -1;
+        }
+
+        // calls f(host) for the hosts of the set, in index order
+        template <typename F>
+        void forEach(F&& f) const
+        {
+            for (std::size_t w = 0; w < words.size(); ++w) {
+                for (uint64_t bits = words[w]; bits; bits &= bits - 1)
+                    f(int(w * 64 + __builtin_ctzll(bits)));
+            }
+        }
+
+        int count() const
+        {
+            int n = 0;
+            for (uint64_t word : words)
+                n += __builtin_popcountll(word);
+            return n;
+        }
+    };
+
+  protected:
+    int numHosts_ = 0;
+    std::vector<double> available_[NUM_RESOURCES];   // per host
+    std::vector<double> amounts_[NUM_RESOURCES];     // per class
+    std::vector<HostSet> classes_[NUM_RESOURCES];    // per class: hosts with available > amount
+    HostSet candidates_;                             // result of findHosts(), reused
+
+  public:
+    static double unknown() { return std::numeric_limits<double>::infinity(); }
+
+    int getNumHosts() const { return numHosts_; }
+    int getNumClasses(Resource resource) const { return amounts_[resource].size(); }
+
+    // appends a host whose availability is unknown (it is in every class)
+    void addHost()
+    {
+        int host = numHosts_++;
+        std::size_t numWords = (numHosts_ + 63) / 64;
+        for (int r = 0; r < NUM_RESOURCES; ++r) {
+            available_[r].push_back(unknown());
+            for (HostSet& set : classes_[r]) {
+                set.words.resize(numWords, 0);
+                set.words[host >> 6] |= uint64_t(1) << (host & 63);
+            }
+        }
+    }
+
+    void removeHost(int host)
+    {
+        int last = numHosts_ - 1;
+        if (host != last)
+            setAvailable(host, available_[RAM][last], available_[DISK][last], available_[CPU][last]);
+
+        // clear the bits of the last host, so the words stay clean past the end
+        setAvailable(last, -unknown(), -unknown(), -unknown());
+        --numHosts_;
+        std::size_t numWords = (numHosts_ + 63) / 64;
+        for (int r = 0; r < NUM_RESOURCES; ++r) {
+            available_[r].pop_back();
+            for (HostSet& set : classes_[r])
+                set.words.resize(numWords);
+        }
+    }
+
+    // unknown() marks a resource as possibly available, until the host is read again
+    void setAvailable(int host, double ram, double disk, double cpu)
+    {
+        const double available[NUM_RESOURCES] = { ram, disk, cpu };
+        const uint64_t bit = uint64_t(1) << (host & 63);
+        for (int r = 0; r < NUM_RESOURCES; ++r) {
+            available_[r][host] = available[r];
+            for (std::size_t c = 0; c < amounts_[r].size(); ++c) {
+                uint64_t& word = classes_[r][c].words[host >> 6];
+                word = amounts_[r][c] < available[r] ? word | bit : word & ~bit;
+            }
+        }
+    }
+
+    void setUnknown(int host) { setAvailable(host, unknown(), unknown(), unknown()); }
+
+    /*
+     * Hosts with more than the given amounts available. The set is reused by the next
+     * call. O(hosts / 64), plus O(hosts) for each amount that was never requested before.
+     */
+    const HostSet& findHosts(double ram, double disk, double cpu)
+    {
+        const HostSet& ramHosts = classes_[RAM][findClass(RAM, ram)];
+        const HostSet& diskHosts = classes_[DISK][findClass(DISK, disk)];
+        const HostSet& cpuHosts = classes_[CPU][findClass(CPU, cpu)];
+
+        candidates_.words.resize(ramHosts.words.size());
+        for (std::size_t w = 0; w < candidates_.words.size(); ++w)
+            candidates_.words[w] = ramHosts.words[w] & diskHosts.words[w] & cpuHosts.words[w];
+        return candidates_;
+    }
+
+  protected:
+    // index of the class of the amount, created if needed
+    int findClass(Resource resource, double amount)
+    {
+        std::vector<double>& amounts = amounts_[resource];
+        for (std::size_t c = 0; c < amounts.size(); ++c) {
+            if (amounts[c] == amount)
+                return c;
+        }
+
+        HostSet set;
+        set.words.assign((numHosts_ + 63) / 64, 0);
+        for (int host = 0; host < numHosts_; ++host) {
+            if (amount < available_[resource][host])
+                set.words[host >> 6] |= uint64_t(1) << (host & 63);
+        }
+        amounts.push_back(amount);
+        classes_[resource].push_back(std::move(set));
+        return amounts.size() - 1;
+    }
+};
+
+} // namespace simu5g
+
+#endif  // __SIMU5G_HOSTFEASIBILITYINDEX_H_
@@ -0,0 +1,405 @@
+#ifndef __SIMU5G_HOSTMETRICSNAPSHOT_H_
+#define __SIMU5G_HOSTMETRICSNAPSHOT_H_
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace simu5g {
+
+/**
+ * HostMetricWeights
+ *
+ * Weights of the latency-aware scoring formula:
+ *   score = wLatency * normLatency + wCpu * cpu + wQueueLen * normQueueLen - wThroughput * normThroughput
+ */
+struct HostMetricWeights
+{
+    double latency = 0.0;
+    double cpu = 0.0;
+    double throughput = 0.0;
+    double queueLen = 0.0;
+};
+
+/**
+ * HostMetricSnapshot
+ *
+ * Structure-of-arrays view of the metrics of all candidate MEC hosts, collected once
+ * per decision. Index i of every array refers to the same host. The maxima used for
+ * normalization are accumulated while the snapshot is filled, so scoring needs a
+ * single pass over contiguous arrays.
+ *
+ * The class does not depend on OMNeT++ so that the scoring kernel can be benchmarked
+ * standalone (see benchmarks/).
+ */
+class HostMetricSnapshot
+{
+  public:
+    std::vector<double> latency;
+    std::vector<double> cpu;
+    std::vector<double> throughput;
+    std::vector<double> queueLen;
+    std::vector<double> penalty;      // multiplicative score penalty (1.0 = none)
+    std::vector<uint8_t> feasible;    // 1 if the host can allocate the requested resources
+
+    // Clears the snapshot while keeping the allocated capacity
+    void reset(std::size_t expectedHosts)
+    {
+        latency.clear();
+        cpu.clear();
+        throughput.clear();
+        queueLen.clear();
+        penalty.clear();
+        feasible.clear();
+
+        latency.reserve(expectedHosts);
+        cpu.reserve(expectedHosts);
+        throughput.reserve(expectedHosts);
+        queueLen.reserve(expectedHosts);
+        penalty.reserve(expectedHosts);
+        feasible.reserve(expectedHosts);
+
+        maxLatency_ = maxThroughput_ = maxQueueLen_ = 0.0;
+    }
+
+    // Appends one host. The maxima take all hosts into account, feasible or not,
+    // as the normalization of the original two-pass formula does.
+    void add(double hostLatency, double hostCpu, double hostThroughput, double hostQueueLen,
+             bool isFeasible, double hostPenalty = 1.0)
+    {
+        latency.push_back(hostLatency);
+        cpu.push_back(hostCpu);
+        throughput.push_back(hostThroughput);
+        queueLen.push_back(hostQueueLen);
+        penalty.push_back(hostPenalty);
+        feasible.push_back(isFeasible ? 1 : 0);
+
+        maxLatency_ = std::max(maxLatency_, hostLatency);
+        maxThroughput_ = std::max(maxThroughput_, hostThroughput);
+        maxQueueLen_ = std::max(maxQueueLen_, hostQueueLen);
+    }
+
+    std::size_t size() const { return latency.size(); }
+
+    /*
+     * Scores every host and returns the index of the lowest score, or -1 if no
+     * feasible host has a finite score. Ties are resolved in favour of the lowest
+     * index, so the result is the same host the sequential loop would pick.
+     *
+     * The scoring loop is branch-free and works on contiguous arrays so that the
+     * compiler can vectorize it; the arg-min runs over the score buffer afterwards.
+     *
+     * @param bestScore if not null, receives the score of the selected host
+     */
+    int selectBest(const HostMetricWeights& w, double *bestScore = nullptr)
+    {
+        const std::size_t n = size();
+        scores_.resize(n);
+
+        // Avoid division by zero
+        const double maxLat = maxLatency_ == 0 ? 1.0 : maxLatency_;
+        const double maxThr = maxThroughput_ == 0 ? 1.0 : maxThroughput_;
+        const double maxQl = maxQueueLen_ == 0 ? 1.0 : maxQueueLen_;
+        const double inf = std::numeric_limits<double>::infinity();
+
+        const double *lat = latency.data();
+        const double *cp = cpu.data();
+        const double *thr = throughput.data();
+        const double *ql = queueLen.data();
+        const double *pen = penalty.data();
+        const uint8_t *feas = feasible.data();
+        double *out = scores_.data();
+
+        // Same operand order as the reference formula to keep results bit-identical
+        for (std::size_t i = 0; i < n; ++i) {
+            double score = (w.latency * (lat[i] / maxLat)
+                          + w.cpu * cp[i]
+                          + w.queueLen * (ql[i] / maxQl)
+                          - w.throughput * (thr[i] / maxThr)) * pen[i];
+            out[i] = feas[i] ? score : inf;
+        }
+
+        int best = -1;
+        double min = std::numeric_limits<double>::max();
+        for (std::size_t i = 0; i < n; ++i) {
+            if (out[i] < min) {
+                min = out[i];
+                best = static_cast<int>(i);
+            }
+        }
+
+        if (bestScore)
+            *bestScore = min;
+        return best;
+    }
+
+    double getMaxLatency() const { return maxLatency_; }
+    double getMaxThroughput() const { return maxThroughput_; }
+    double getMaxQueueLen() const { return maxQueueLen_; }
+
+  private:
+    double maxLatency_ = 0.0;
+    double maxThroughput_ = 0.0;
+    double maxQueueLen_ = 0.0;
+    std::vector<double> scores_;  // scratch buffer reused across decisions
+};
+
+/**
+ * HostScoreIndex
+ *
+ * Latency-aware scores of all candidate MEC hosts kept in an indexed binary min-heap,
+ * so that a decision only rescores the hosts whose metrics changed since the last one:
+ *
+ *  - markDirty() flags a host; refresh() reads the metrics of the flagged hosts only and
+ *    moves them in the heap, O(d log M) for d dirty hosts
+ *  - select() walks the heap in score order and returns the first host accepted by the
+ *    feasibility test of the request, O(log M) when the best host is feasible
+ *  - scores are normalized by the maxima over all the hosts, as in HostMetricSnapshot:
+ *    when an update moves one of the maxima, when the weights change or after
+ *    invalidate(), refresh() rescans all the hosts and rebuilds the heap in O(M)
+ *
+ * Scores and tie-breaking (lowest index) are those of HostMetricSnapshot::selectBest()
+ * without penalty, so both pick the same host.
+ *
+ * The class does not depend on OMNeT++.
+ */
+class HostScoreIndex
+{
+  public:
+    struct Metrics
+    {
+        double latency = 0.0;
+        double cpu = 0.0;
+        double throughput = 0.0;
+        double queueLen = 0.0;
+    };
+
+  protected:
+    std::vector<Metrics> metrics_;
+    std::vector<double> scores_;
+    std::vector<int> heap_;           // host indices, ordered by (score, index)
+    std::vector<int> position_;       // host index -> position in heap_
+    std::vector<uint8_t> dirty_;
+    std::vector<int> dirtyHosts_;
+    std::vector<int> frontier_;       // scratch heap of positions, reused by select()
+    HostMetricWeights weights_;
+    double maxLatency_ = 0.0;
+    double maxThroughput_ = 0.0;
+    double maxQueueLen_ = 0.0;
+    bool valid_ = false;
+
+    unsigned long fullRescans_ = 0;
+    unsigned long partialRefreshes_ = 0;
+    unsigned long rescoredHosts_ = 0;
+
+  public:
+    int size() const { return heap_.size(); }
+
+    // forces a full rescan at the next refresh() (e.g. the host set changed)
+    void invalidate() { valid_ = false; }
+
+    void markDirty(int host)
+    {
+        if (!valid_ || host < 0 || host >= size() || dirty_[host])
+            return;
+        dirty_[host] = 1;
+        dirtyHosts_.push_back(host);
+    }
+
+    /*
+     * Brings the scores up to date. fetch(i) returns the Metrics of host i: it is called
+     * for the dirty hosts only, in index order, or for all the hosts on a full rescan.
+     *
+     * @return true if all the hosts were rescored
+     */
+    template <typename Fetch>
+    bool refresh(int numHosts, const HostMetricWeights& w, Fetch&& fetch)
+    {
+        if (!valid_ || numHosts != size() || !sameWeights(w)) {
+            weights_ = w;
+            metrics_.resize(numHosts);
+            for (int i = 0; i < numHosts; ++i)
+                metrics_[i] = fetch(i);
+            rebuild();
+            return true;
+        }
+        if (dirtyHosts_.empty())
+            return false;
+
+        std::sort(dirtyHosts_.begin(), dirtyHosts_.end());
+        bool maxMoved = false;
+        for (int host : dirtyHosts_) {
+            Metrics old = metrics_[host];
+            const Metrics& m = metrics_[host] = fetch(host);
+            maxMoved = maxMoved || movesMax(old.latency, m.latency, maxLatency_)
+                                || movesMax(old.throughput, m.throughput, maxThroughput_)
+                                || movesMax(old.queueLen, m.queueLen, maxQueueLen_);
+        }
+        if (maxMoved) {
+            rebuild();
+            return true;
+        }
+
+        for (int host : dirtyHosts_) {
+            scores_[host] = computeScore(metrics_[host]);
+            siftUp(position_[host]);
+            siftDown(position_[host]);
+            dirty_[host] = 0;
+        }
+        rescoredHosts_ += dirtyHosts_.size();
+        dirtyHosts_.clear();
+        ++partialRefreshes_;
+        return false;
+    }
+
+    /*
+     * Returns the host with the lowest score among those accepted by accept(i), or -1 if
+     * none has a finite score. Hosts are tested in score order, so accept() is only called
+     * for the hosts scoring better than the selected one (and for the selected one).
+     *
+     * @param bestScore if not null, receives the score of the selected host
+     */
+    template <typename Accept>
+    int select(Accept&& accept, double *bestScore = nullptr)
+    {
+        // frontier_ is a min-heap of positions of heap_: the children of a visited node
+        // are the only candidates for the next host in score order
+        auto after = [this](int a, int b) { return before(heap_[b], heap_[a]); };
+        frontier_.clear();
+        if (!heap_.empty())
+            frontier_.push_back(0);
+        while (!frontier_.empty()) {
+            std::pop_heap(frontier_.begin(), frontier_.end(), after);
+            int pos = frontier_.back();
+            frontier_.pop_back();
+
+            int host = heap_[pos];
+            if (!(scores_[host] < std::numeric_limits<double>::max()))
+                break;
+            if (accept(host)) {
+                if (bestScore)
+                    *bestScore = scores_[host];
+                return host;
+            }
+            for (int child = 2 * pos + 1; child <= 2 * pos + 2 && child < size(); ++child) {
+                frontier_.push_back(child);
+                std::push_heap(frontier_.begin(), frontier_.end(), after);
+            }
+        }
+        if (bestScore)
+            *bestScore = std::numeric_limits<double>::max();
+        return -1;
+    }
+
+    const Metrics& getMetrics(int host) const { return metrics_[host]; }
+    double getScore(int host) const { return scores_[host]; }
+    double getMaxLatency() const { return maxLatency_; }
+
+    unsigned long getFullRescans() const { return fullRescans_; }
+    unsigned long getPartialRefreshes() const { return partialRefreshes_; }
+    unsigned long getRescoredHosts() const { return rescoredHosts_; }
+
+  protected:
+    bool sameWeights(const HostMetricWeights& w) const
+    {
+        return w.latency == weights_.latency && w.cpu == weights_.cpu
+            && w.throughput == weights_.throughput && w.queueLen == weights_.queueLen;
+    }
+
+    // whether replacing value old with value now changes the maximum max
+    static bool movesMax(double old, double now, double max)
+    {
+        return now > max || (old == max && now < max);
+    }
+
+    double computeScore(const Metrics& m) const
+    {
+        // Avoid division by zero
+        const double maxLat = maxLatency_ == 0 ? 1.0 : maxLatency_;
+        const double maxThr = maxThroughput_ == 0 ? 1.0 : maxThroughput_;
+        const double maxQl = maxQueueLen_ == 0 ? 1.0 : maxQueueLen_;
+
+        // Same operand order as HostMetricSnapshot::selectBest() to keep results bit-identical
+        return weights_.latency * (m.latency / maxLat)
+             + weights_.cpu * m.cpu
+             + weights_.queueLen * (m.queueLen / maxQl)
+             - weights_.throughput * (m.throughput / maxThr);
+    }
+
+    // rescores all the hosts with the current maxima and re-heapifies, O(M)
+    void rebuild()
+    {
+        const int n = metrics_.size();
+        maxLatency_ = maxThroughput_ = maxQueueLen_ = 0.0;
+        for (const Metrics& m : metrics_) {
+            maxLatency_ = std::max(maxLatency_, m.latency);
+            maxThroughput_ = std::max(maxThroughput_, m.throughput);
+            maxQueueLen_ = std::max(maxQueueLen_, m.queueLen);
+        }
+
+        scores_.resize(n);
+        heap_.resize(n);
+        position_.resize(n);
+        for (int i = 0; i < n; ++i) {
+            scores_[i] = computeScore(metrics_[i]);
+            heap_[i] = i;
+            position_[i] = i;
+        }
+        for (int pos = n / 2 - 1; pos >= 0; --pos)
+            siftDown(pos);
+
+        dirty_.assign(n, 0);
+        dirtyHosts_.clear();
+        valid_ = true;
+        ++fullRescans_;
+        rescoredHosts_ += n;
+    }
+
+    bool before(int a, int b) const
+    {
+        return scores_[a] < scores_[b] || (scores_[a] == scores_[b] && a < b);
+    }
+
+    void place(int pos, int host)
+    {
+        heap_[pos] = host;
+        position_[host] = pos;
+    }
+
+    void siftUp(int pos)
+    {
+        int host = heap_[pos];
+        while (pos > 0) {
+            int parent = (pos - 1) / 2;
+            if (!before(host, heap_[parent]))
+                break;
+            place(pos, heap_[parent]);
+            pos = parent;
+        }
+        place(pos, host);
+    }
+
+    void siftDown(int pos)
+    {
+        const int n = size();
+        int host = heap_[pos];
+        while (true) {
+            int child = 2 * pos + 1;
+            if (child >= n)
+                break;
+            if (child + 1 < n && before(heap_[child + 1], heap_[child]))
+                ++child;
+            if (!before(heap_[child], host))
+                break;
+            place(pos, heap_[child]);
+            pos = child;
+        }
+        place(pos, host);
+    }
+};
+
+} // namespace simu5g
+
+#endif  // __SIMU5G_HOSTMETRICSNAPSHOT_H_
@@ -0,0 +1,127 @@
+#ifndef __SIMU5G_HOSTRESERVATIONLEDGER_H_
+#define __SIMU5G_HOSTRESERVATIONLEDGER_H_
+
+#include <unordered_map>
+#include <vector>
+
+namespace simu5g {
+
+/**
+ * HostReservationLedger
+ *
+ * Resources promised to MEC hosts by placement decisions that are not carried out yet,
+ * i.e. not accounted for by the VIMs. Every reservation belongs to a request and holds
+ * on one host until it is committed (the VIM now accounts for the resources) or rolled
+ * back (the placement failed). The pending totals of a host are subtracted from what its
+ * VIM reports, so the decisions taken in the meantime see each other.
+ *
+ *  - reserve(), commit() and rollback() are O(1)
+ *  - the per-host totals are index-aligned with the MecHostRegistry: removeHost() moves
+ *    the last host into the removed one, O(reservations)
+ *
+ * A request holds at most one reservation: reserving again replaces it.
+ *
+ * The class does not depend on OMNeT++.
+ */
+class HostReservationLedger
+{
+  public:
+    struct Resources
+    {
+        double ram = 0.0;
+        double disk = 0.0;
+        double cpu = 0.0;
+        int count = 0;                 // number of reservations
+    };
+
+  protected:
+    struct Reservation
+    {
+        int host;
+        double ram, disk, cpu;
+    };
+
+    std::unordered_map<unsigned int, Reservation> reservations_;   // key = request id
+    std::vector<Resources> pending_;                                // per host
+
+  public:
+    int getNumHosts() const { return pending_.size(); }
+
+    void addHost() { pending_.emplace_back(); }
+
+    // drops the reservations on the host
+    void removeHost(int host)
+    {
+        int last = pending_.size() - 1;
+        for (auto it = reservations_.begin(); it != reservations_.end(); ) {
+            if (it->second.host == host) {
+                it = reservations_.erase(it);
+                continue;
+            }
+            if (it->second.host == last)
+                it->second.host = host;
+            ++it;
+        }
+        pending_[host] = pending_[last];
+        pending_.pop_back();
+    }
+
+    void reserve(unsigned int requestId, int host, double ram, double disk, double cpu)
+    {
+        rollback(requestId);
+        reservations_[requestId] = { host, ram, disk, cpu };
+        Resources& pending = pending_[host];
+        pending.ram += ram;
+        pending.disk += disk;
+        pending.cpu += cpu;
+        ++pending.count;
+    }
+
+    // the resources are now accounted for elsewhere; returns the host, -1 if no reservation
+    int commit(unsigned int requestId) { return release(requestId); }
+
+    // the placement failed; returns the host, -1 if no reservation
+    int rollback(unsigned int requestId) { return release(requestId); }
+
+    const Resources& getPending(int host) const { return pending_[host]; }
+
+    bool contains(unsigned int requestId) const { return reservations_.count(requestId) != 0; }
+    bool empty() const { return reservations_.empty(); }
+    std::size_t size() const { return reservations_.size(); }
+
+    // calls f(host) for the hosts holding reservations
+    template <typename F>
+    void forEachReservedHost(F&& f) const
+    {
+        for (int host = 0; host < (int)pending_.size(); ++host) {
+            if (pending_[host].count > 0)
+                f(host);
+        }
+    }
+
+  protected:
+    int release(unsigned int requestId)
+    {
+        auto it = reservations_.find(requestId);
+        if (it == reservations_.end())
+            return -1;
+
+        const Reservation& reservation = it->second;
+        Resources& pending = pending_[reservation.host];
+        if (--pending.count == 0) {
+            pending = Resources();   // no rounding residue
+        }
+        else {
+            pending.ram -= reservation.ram;
+            pending.disk -= reservation.disk;
+            pending.cpu -= reservation.cpu;
+        }
+        int host = reservation.host;
+        reservations_.erase(it);
+        return host;
+    }
+};
+
+} // namespace simu5g
+
+#endif  // __SIMU5G_HOSTRESERVATIONLEDGER_H_
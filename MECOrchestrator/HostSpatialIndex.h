@@ -0,0 +1,212 @@
+#ifndef __SIMU5G_HOSTSPATIALINDEX_H_
+#define __SIMU5G_HOSTSPATIALINDEX_H_
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace simu5g {
+
+/**
+ * HostSpatialIndex
+ *
+ * Where the MEC hosts are with respect to the cells (base stations), to restrict the
+ * selection to the hosts near the cell serving a UE. Hosts and cells are dense indices
+ * (registry index, cell index of the orchestrator). Every host is attached to the cells
+ * of its bsList and placed at the centroid of their positions:
+ *
+ *  - getCellHosts() is the cell -> host adjacency list, O(1)
+ *  - findNearest() returns the hosts closest to a cell from a 2D k-d tree over the host
+ *    positions, O(log hosts + count) on average
+ *
+ * Hosts attached to no cell with a known position have no position; they are listed by
+ * getUnplacedHosts(). The tree is rebuilt on the first lookup after a change, O(hosts log
+ * hosts): the index is meant for host sets that change rarely.
+ *
+ * The class does not depend on OMNeT++.
+ */
+class HostSpatialIndex
+{
+  protected:
+    struct Point
+    {
+        double x = 0.0, y = 0.0;
+    };
+
+    std::vector<Point> cellPositions_;
+    std::vector<char> cellPlaced_;
+    std::vector<std::vector<int>> hostCells_;    // per host
+    std::vector<std::vector<int>> cellHosts_;    // per cell
+    std::vector<int> unplacedHosts_;
+
+    // implicit k-d tree: the median of tree_[lo, hi) is at (lo + hi) / 2, split on x at even depths
+    std::vector<int> tree_;
+    std::vector<Point> hostPositions_;
+    bool dirty_ = true;
+
+    // bounded max-heap of (squared distance, host) used by findNearest()
+    std::vector<std::pair<double, int>> heap_;
+
+  public:
+    // drops every host and cell
+    void reset(int numHosts)
+    {
+        cellPositions_.clear();
+        cellPlaced_.clear();
+        cellHosts_.clear();
+        hostCells_.assign(numHosts, std::vector<int>());
+        dirty_ = true;
+    }
+
+    int getNumHosts() const { return hostCells_.size(); }
+
+    void setCellPosition(int cell, double x, double y)
+    {
+        ensureCell(cell);
+        cellPositions_[cell] = { x, y };
+        cellPlaced_[cell] = 1;
+        dirty_ = true;
+    }
+
+    bool hasCellPosition(int cell) const { return cell >= 0 && cell < (int)cellPlaced_.size() && cellPlaced_[cell]; }
+
+    void addHostCell(int host, int cell)
+    {
+        ensureCell(cell);
+        std::vector<int>& hosts = cellHosts_[cell];
+        if (std::find(hosts.begin(), hosts.end(), host) != hosts.end())
+            return;
+        hosts.push_back(host);
+        hostCells_[host].push_back(cell);
+        dirty_ = true;
+    }
+
+    const std::vector<int>& getCellHosts(int cell) const
+    {
+        static const std::vector<int> none;
+        return cell >= 0 && cell < (int)cellHosts_.size() ? cellHosts_[cell] : none;
+    }
+
+    const std::vector<int>& getUnplacedHosts()
+    {
+        rebuild();
+        return unplacedHosts_;
+    }
+
+    int getNumPlacedHosts()
+    {
+        rebuild();
+        return tree_.size();
+    }
+
+    /*
+     * The count placed hosts closest to the cell, nearest first (ties in host order);
+     * fewer if there are not as many. The cell must have a position.
+     */
+    void findNearest(int cell, int count, std::vector<int>& hosts)
+    {
+        rebuild();
+        hosts.clear();
+        if (count <= 0 || !hasCellPosition(cell))
+            return;
+
+        heap_.clear();
+        search(cellPositions_[cell], count, 0, tree_.size(), 0);
+        std::sort_heap(heap_.begin(), heap_.end());
+        for (const auto& entry : heap_)
+            hosts.push_back(entry.second);
+    }
+
+  protected:
+    void ensureCell(int cell)
+    {
+        if (cell >= (int)cellPositions_.size()) {
+            cellPositions_.resize(cell + 1);
+            cellPlaced_.resize(cell + 1, 0);
+            cellHosts_.resize(cell + 1);
+        }
+    }
+
+    void rebuild()
+    {
+        if (!dirty_)
+            return;
+        dirty_ = false;
+
+        // hosts at the centroid of their placed cells
+        tree_.clear();
+        unplacedHosts_.clear();
+        hostPositions_.assign(hostCells_.size(), Point());
+        for (int host = 0; host < (int)hostCells_.size(); ++host) {
+            Point& position = hostPositions_[host];
+            int numPlaced = 0;
+            for (int cell : hostCells_[host]) {
+                if (!cellPlaced_[cell])
+                    continue;
+                position.x += cellPositions_[cell].x;
+                position.y += cellPositions_[cell].y;
+                ++numPlaced;
+            }
+            if (numPlaced == 0) {
+                unplacedHosts_.push_back(host);
+                continue;
+            }
+            position.x /= numPlaced;
+            position.y /= numPlaced;
+            tree_.push_back(host);
+        }
+        build(0, tree_.size(), 0);
+    }
+
+    double coordinate(int host, int depth) const { return depth % 2 == 0 ? hostPositions_[host].x : hostPositions_[host].y; }
+
+    void build(std::size_t lo, std::size_t hi, int depth)
+    {
+        if (hi - lo <= 1)
+            return;
+        std::size_t mid = (lo + hi) / 2;
+        std::nth_element(tree_.begin() + lo, tree_.begin() + mid, tree_.begin() + hi, [this, depth](int a, int b) {
+            return coordinate(a, depth) < coordinate(b, depth);
+        });
+        build(lo, mid, depth + 1);
+        build(mid + 1, hi, depth + 1);
+    }
+
+    void search(const Point& target, int count, std::size_t lo, std::size_t hi, int depth)
+    {
+        if (lo >= hi)
+            return;
+        std::size_t mid = (lo + hi) / 2;
+        int host = tree_[mid];
+        double dx = hostPositions_[host].x - target.x;
+        double dy = hostPositions_[host].y - target.y;
+        std::pair<double, int> entry(dx * dx + dy * dy, host);
+        if ((int)heap_.size() < count) {
+            heap_.push_back(entry);
+            std::push_heap(heap_.begin(), heap_.end());
+        }
+        else if (entry < heap_.front()) {
+            std::pop_heap(heap_.begin(), heap_.end());
+            heap_.back() = entry;
+            std::push_heap(heap_.begin(), heap_.end());
+        }
+
+        // the side of the target first, the other one if it can hold a closer host
+        double split = depth % 2 == 0 ? dx : dy;
+        bool targetBelow = split > 0;
+        if (targetBelow)
+            search(target, count, lo, mid, depth + 1);
+        else
+            search(target, count, mid + 1, hi, depth + 1);
+        if ((int)heap_.size() < count || split * split <= heap_.front().first) {
+            if (targetBelow)
+                search(target, count, mid + 1, hi, depth + 1);
+            else
+                search(target, count, lo, mid, depth + 1);
+        }
+    }
+};
+
+} // namespace simu5g
+
+#endif  // __SIMU5G_HOSTSPATIALINDEX_H_
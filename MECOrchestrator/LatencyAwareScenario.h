@@ -0,0 +1,79 @@
+#ifndef __SIMU5G_LATENCYAWARESCENARIO_H_
+#define __SIMU5G_LATENCYAWARESCENARIO_H_
+
+#include <omnetpp.h>
+#include <cstring>
+
+namespace simu5g {
+
+using namespace omnetpp;
+
+/*
+ * Scenario traits (latencyAwareScenario parameter of the orchestrator).
+ *
+ * Selection hooks, used by LatencyAwareSelection: a scenario either pins the selection
+ * to a host (pinnedHostName) or scores the hosts, with an optional random penalty
+ * multiplying every score (randomPenalty / drawPenalty()).
+ *
+ * Instantiation hooks, used by the orchestrator: the probability that the instantiation
+ * on the selected host is forced to fail (failureProbability()) and the delay added to
+ * every instantiation, failed or not (extraDelay()).
+ */
+
+// Best case: the host that also provides the MEC service is always selected
+struct BestScenario
+{
+    static constexpr const char *name = "best";
+    static constexpr const char *pinnedHostName = "mecHost2";
+    static constexpr double pinnedHostLatency = 0.5;        // reported latency of the pinned host, s
+    static constexpr bool randomPenalty = false;
+    static double drawPenalty() { return 1.0; }
+    static double failureProbability() { return 0.0; }
+    static simtime_t extraDelay() { return SIMTIME_ZERO; }
+};
+
+// Moderate case: plain weighted scoring of the measured metrics
+struct ModerateScenario
+{
+    static constexpr const char *name = "moderate";
+    static constexpr const char *pinnedHostName = nullptr;
+    static constexpr double pinnedHostLatency = 0.0;
+    static constexpr bool randomPenalty = false;
+    static double drawPenalty() { return 1.0; }
+    static double failureProbability() { return 0.0; }
+    static simtime_t extraDelay() { return SIMTIME_ZERO; }
+};
+
+// Worst case: artificial noise degrades the score of every feasible host, 30% of the
+// instantiations fail and all of them take 100ms more
+struct WorstScenario
+{
+    static constexpr const char *name = "worst";
+    static constexpr const char *pinnedHostName = nullptr;
+    static constexpr double pinnedHostLatency = 0.0;
+    static constexpr bool randomPenalty = true;
+    static double drawPenalty() { return 1.5 + 0.5 * getEnvir()->getRNG(0)->doubleRand(); }
+    static double failureProbability() { return 0.3; }
+    static simtime_t extraDelay() { return SimTime(100.0, SIMTIME_MS); }
+};
+
+/*
+ * Calls f(Traits()) with the traits of the named scenario ("best", "moderate" or "worst"),
+ * so that f can instantiate templates on them.
+ */
+template <typename F>
+void withLatencyAwareScenario(const char *scenario, F&& f)
+{
+    if (!strcmp(scenario, BestScenario::name))
+        f(BestScenario());
+    else if (!strcmp(scenario, ModerateScenario::name))
+        f(ModerateScenario());
+    else if (!strcmp(scenario, WorstScenario::name))
+        f(WorstScenario());
+    else
+        throw cRuntimeError("Unknown LatencyAware scenario: '%s'", scenario);
+}
+
+} // namespace simu5g
+
+#endif  // __SIMU5G_LATENCYAWARESCENARIO_H_
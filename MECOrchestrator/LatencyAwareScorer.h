@@ -0,0 +1,193 @@
+#ifndef __SIMU5G_LATENCYAWARESCORER_H_
+#define __SIMU5G_LATENCYAWARESCORER_H_
+
+#include "HostMetricSnapshot.h"
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace simu5g {
+
+/**
+ * LatencyAwareScorer
+ *
+ * Host scoring and selection of LatencyAwareSelection, on top of a view of the MEC hosts
+ * (the Hosts template argument), which provides:
+ *
+ *  - randomPenalty               : static constexpr bool, whether drawPenalty() is not 1.0
+ *  - size(), getVersion()        : number of hosts, and a number changing with the host set
+ *  - getCell()                   : cell of the current request, the key of the score index
+ *  - isVolatile(i)               : whether the latency of host i is resampled at every decision
+ *  - getLatency(i), getCpu(i), getThroughput(i), getQueueLength(i) : the metrics of host i
+ *  - isFeasible(i)               : whether host i can allocate the current request
+ *  - drawPenalty(), drawHost(n)  : a score penalty, and a host index drawn in [0, n)
+ *
+ * Without a random penalty the scores are kept in a HostScoreIndex per cell and only the
+ * hosts passed to invalidate() (and the volatile ones) are rescored; with a random penalty
+ * every feasible host is scored at every decision. A subset of the hosts (the hosts near
+ * the cell, or numChoices hosts drawn by drawSample()) is normalized among itself.
+ *
+ * The class does not depend on OMNeT++ so that the policy can be benchmarked standalone
+ * (see benchmarks/).
+ */
+template <typename Hosts>
+class LatencyAwareScorer
+{
+  protected:
+    HostMetricWeights weights;
+
+    // Host scores per cell (-1 = unknown cell), without random penalty
+    std::unordered_map<int, HostScoreIndex> scoreIndexes;
+    std::vector<int> volatileHosts;  // hosts resampled at every decision
+    unsigned long hostsVersion = 0;
+
+    HostMetricSnapshot snapshot;     // metrics of the scanned, sampled or nearby hosts
+
+    // Power of d choices (numChoices = 0: every host is scored)
+    int numChoices = 0;
+    std::vector<int> sampleHosts;    // indices of the sampled hosts
+
+  public:
+    explicit LatencyAwareScorer(int numChoices = 0) : numChoices(numChoices) {}
+
+    // a change of the weights is detected by the score indexes themselves
+    void setWeights(const HostMetricWeights& w) { weights = w; }
+    const HostMetricWeights& getWeights() const { return weights; }
+    int getNumChoices() const { return numChoices; }
+
+    // Marks the host to be rescored at the next decision (-1: all the hosts)
+    void invalidate(int hostIndex)
+    {
+        for (auto& entry : scoreIndexes) {
+            if (hostIndex < 0)
+                entry.second.invalidate();
+            else
+                entry.second.markDirty(hostIndex);
+        }
+        if (hostIndex < 0)
+            hostsVersion = 0;  // also rebuilds volatileHosts
+    }
+
+    /*
+     * Returns the index of the host with the lowest score, or -1 if no feasible host has
+     * a finite score. With subset, only those hosts (all feasible) are scored; otherwise
+     * all the hosts are.
+     *
+     * @param latency receives the latency of the selected host
+     */
+    int select(Hosts& hosts, const std::vector<int> *subset, double& bestScore, double& latency)
+    {
+        if (subset)
+            return scoreHosts(hosts, *subset, bestScore, latency);
+        else if constexpr (Hosts::randomPenalty)
+            return scanHosts(hosts, bestScore, latency);
+        else
+            return selectIndexed(hosts, bestScore, latency);
+    }
+
+    // Draws numChoices distinct feasible hosts (infeasible draws are redrawn, up to 4d
+    // draws); returns nullptr if none was found
+    const std::vector<int> *drawSample(Hosts& hosts)
+    {
+        const int n = hosts.size();
+        sampleHosts.clear();
+        for (int draw = 0; draw < 4 * numChoices && (int)sampleHosts.size() < numChoices && n > 0; draw++) {
+            int i = hosts.drawHost(n);
+            if (std::find(sampleHosts.begin(), sampleHosts.end(), i) != sampleHosts.end() || !hosts.isFeasible(i))
+                continue;
+            sampleHosts.push_back(i);
+        }
+        return sampleHosts.empty() ? nullptr : &sampleHosts;
+    }
+
+    // Score index of the cell of the current request, if already built
+    const HostScoreIndex *findScoreIndex(int cell) const
+    {
+        auto it = scoreIndexes.find(cell);
+        return it == scoreIndexes.end() ? nullptr : &it->second;
+    }
+
+  protected:
+    // Score index of the cell of the current request, reset when the host set changes
+    HostScoreIndex& getScoreIndex(Hosts& hosts)
+    {
+        // joins and leaves move hosts to other indices: start over
+        if (hosts.getVersion() != hostsVersion) {
+            hostsVersion = hosts.getVersion();
+            scoreIndexes.clear();
+            volatileHosts.clear();
+            for (int i = 0; i < hosts.size(); i++) {
+                if (hosts.isVolatile(i))
+                    volatileHosts.push_back(i);
+            }
+        }
+
+        HostScoreIndex& index = scoreIndexes[hosts.getCell()];
+        for (int i : volatileHosts)
+            index.markDirty(i);
+        return index;
+    }
+
+    // All the hosts, from the score index: the hosts that changed since the last decision are
+    // rescored (all of them after a change of the host set, of the weights or of the maxima)
+    int selectIndexed(Hosts& hosts, double& bestScore, double& latency)
+    {
+        HostScoreIndex& index = getScoreIndex(hosts);
+        index.refresh(hosts.size(), weights, [&hosts](int i) {
+            HostScoreIndex::Metrics metrics;
+            metrics.latency = hosts.getLatency(i);
+            metrics.cpu = hosts.getCpu(i);
+            metrics.throughput = hosts.getThroughput(i);
+            metrics.queueLen = hosts.getQueueLength(i);
+            return metrics;
+        });
+
+        // Walk the hosts in score order up to the first one with enough resources
+        int best = index.select([&hosts](int i) { return hosts.isFeasible(i); }, &bestScore);
+        if (best >= 0)
+            latency = index.getMetrics(best).latency;
+        return best;
+    }
+
+    // All the hosts, in a single pass collecting the metrics and the normalization maxima
+    int scanHosts(Hosts& hosts, double& bestScore, double& latency)
+    {
+        snapshot.reset(hosts.size());
+        for (int i = 0; i < hosts.size(); i++) {
+            bool feasible = hosts.isFeasible(i);
+
+            // drawn for feasible hosts only and in host order, as the sequential loop did
+            double penaltyFactor = feasible ? hosts.drawPenalty() : 1.0;
+
+            // the state of an infeasible host is not read
+            snapshot.add(hosts.getLatency(i), feasible ? hosts.getCpu(i) : 1.0,
+                         hosts.getThroughput(i), hosts.getQueueLength(i), feasible, penaltyFactor);
+        }
+
+        int best = snapshot.selectBest(weights, &bestScore);
+        if (best >= 0)
+            latency = snapshot.latency[best];
+        return best;
+    }
+
+    // The given feasible hosts, normalized among themselves
+    int scoreHosts(Hosts& hosts, const std::vector<int>& subset, double& bestScore, double& latency)
+    {
+        snapshot.reset(subset.size());
+        for (int i : subset) {
+            double penaltyFactor = hosts.drawPenalty();
+            snapshot.add(hosts.getLatency(i), hosts.getCpu(i), hosts.getThroughput(i), hosts.getQueueLength(i),
+                         true, penaltyFactor);
+        }
+
+        int best = snapshot.selectBest(weights, &bestScore);
+        if (best < 0)
+            return -1;
+        latency = snapshot.latency[best];
+        return subset[best];
+    }
+};
+
+} // namespace simu5g
+
+#endif  // __SIMU5G_LATENCYAWARESCORER_H_
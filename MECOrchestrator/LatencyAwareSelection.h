@@ -0,0 +1,194 @@
+#ifndef __SIMU5G_LATENCYAWARESELECTION_H_
+#define __SIMU5G_LATENCYAWARESELECTION_H_
+
+#include "nodes/mec/MECOrchestrator/mecHostSelectionPolicies/SelectionPolicyBase.h"
+#include "nodes/mec/MECOrchestrator/mecHostSelectionPolicies/LatencyAwareScorer.h"
+#include "nodes/mec/MECOrchestrator/LatencyAwareScenario.h"
+#include <cstring>
+#include <vector>
+
+namespace simu5g {
+
+/**
+ * LatencyAwareSelection
+ *
+ * MEC host selection policy scoring the hosts on:
+ *  - Network latency (measured RTT per cell, topology latency or the hostLatencies table)
+ *  - CPU utilization (from the state published by the VIM)
+ *  - Throughput (measured on the NIC)
+ *  - Queue length (measured on the NIC queue)
+ *
+ * score = wLatency * normLatency + wCpu * cpu + wQueueLen * normQueueLen - wThroughput * normThroughput,
+ * times the penalty of the scenario; the lowest score wins. The scenario is a template
+ * argument, so its hooks are resolved at compile time and the scoring loops make no
+ * virtual calls; the orchestrator picks the instance from latencyAwareScenario (see
+ * createLatencyAwareSelection()).
+ *
+ * Without a random penalty, a score only changes with the metrics of its host, so the
+ * scores are kept in a HostScoreIndex per cell and only the hosts reported as changed
+ * are rescored. With a random penalty every feasible host is scored at every decision.
+ *
+ * With numChoices > 0 (selectionPolicy "LatencyAwareSampled") only numChoices feasible
+ * hosts drawn at random are scored (power of d choices), and with spatial pruning
+ * (spatialCandidates) only the hosts near the cell of the UE; both are normalized among
+ * themselves.
+ *
+ * The scoring and the selection are those of LatencyAwareScorer, on a view of the registry
+ * of the orchestrator (OrchestratorHosts); this class reads the weights and the metrics.
+ */
+template <typename ScenarioTraits>
+class LatencyAwareSelection : public SelectionPolicyBase
+{
+  protected:
+    // The registry of the orchestrator as seen by the scorer, for one request
+    struct OrchestratorHosts
+    {
+        static constexpr bool randomPenalty = ScenarioTraits::randomPenalty;
+
+        LatencyAwareSelection *policy;
+        const ResourceDescriptor& resources;
+        const HostFeasibilityIndex::HostSet& candidates;  // hosts in the availability classes of the request
+        int samplingRng;
+
+        int size() const { return policy->getMecHosts().size(); }
+        unsigned long getVersion() const { return policy->getMecHosts().getVersion(); }
+        int getCell() const { return policy->mecOrchestrator_->getRequestCell(); }
+        bool isVolatile(int i) const { return policy->getMecHosts()[i].latencyExpression != nullptr; }
+
+        double getLatency(int i) const { return policy->getHostLatency(i); }
+        double getCpu(int i) const { return policy->getHostCpuUtil(policy->mecOrchestrator_->getHostState(i)); }  // no VIM call unless it changed
+        double getThroughput(int i) const { return policy->getHostThroughput(i); }
+        double getQueueLength(int i) const { return policy->getHostQueueLength(i); }
+
+        bool isFeasible(int i) const
+        {
+            // the state of a host outside the availability classes of the request is not read
+            bool feasible = candidates.contains(i)
+                    && policy->mecOrchestrator_->getHostState(i).isAllocable(resources.ram, resources.disk, resources.cpu);
+            if (!feasible)
+                EV_INFO << "[LatencyAware] Insufficient resources on " << policy->getMecHosts()[i].module->getName() << ", skipping.\n";
+            return feasible;
+        }
+
+        static double drawPenalty() { return ScenarioTraits::drawPenalty(); }
+        int drawHost(int n) const { return policy->mecOrchestrator_->getRNG(samplingRng)->intRand(n); }
+    };
+
+    LatencyAwareScorer<OrchestratorHosts> scorer;  // weights, score indexes and sample
+    int samplingRng = 0;             // local RNG index of the orchestrator used for the draws
+
+  public:
+    LatencyAwareSelection(MecOrchestrator *orchestrator, int numChoices = 0, int samplingRng = 0)
+        : SelectionPolicyBase(orchestrator), scorer(numChoices), samplingRng(samplingRng)
+    {
+        readWeights();
+    }
+
+    cModule *findBestMecHost(const ApplicationDescriptor& appDesc) override
+    {
+        if constexpr (ScenarioTraits::pinnedHostName != nullptr)
+            return findPinnedHost();
+        else
+            return findScoredHost(appDesc);
+    }
+
+    // Refreshes the cached weights when one of them changes at run time
+    void handleParameterChange(const char *parname) override
+    {
+        if (!parname || !strcmp(parname, "latencyWeight") || !strcmp(parname, "cpuWeight")
+                || !strcmp(parname, "throughputWeight") || !strcmp(parname, "queueLenWeight"))
+            readWeights();
+        // other parameters of the orchestrator can change the metrics (e.g. hostLatencies)
+        else
+            handleHostChange(-1);
+    }
+
+    // Marks the host to be rescored at the next decision
+    void handleHostChange(int hostIndex) override { scorer.invalidate(hostIndex); }
+
+  protected:
+    void readWeights()
+    {
+        HostMetricWeights weights;
+        weights.latency = mecOrchestrator_->par("latencyWeight").doubleValue();
+        weights.cpu = mecOrchestrator_->par("cpuWeight").doubleValue();
+        weights.throughput = mecOrchestrator_->par("throughputWeight").doubleValue();
+        weights.queueLen = mecOrchestrator_->par("queueLenWeight").doubleValue();
+        scorer.setWeights(weights);
+    }
+
+    // METRIC HOOKS
+
+    // Measured RTT from the cell of the UE if available, else the latency table of the orchestrator
+    double getHostLatency(int hostIndex) const { return mecOrchestrator_->getHostLatency(hostIndex); }
+
+    // Allocated CPU fraction (0.0 to 1.0) as last published by the VIM
+    double getHostCpuUtil(const MecHostState& state) const { return state.usedCpu; }
+
+    // tx + rx bitrate of the NIC over the traffic meter window of the orchestrator
+    double getHostThroughput(int hostIndex) const { return mecOrchestrator_->getHostThroughput(hostIndex); }
+
+    // current occupancy of the NIC queue, in bits
+    double getHostQueueLength(int hostIndex) const { return mecOrchestrator_->getHostQueueLength(hostIndex); }
+
+    cModule *findPinnedHost()
+    {
+        mecOrchestrator_->bestLatency = SimTime(ScenarioTraits::pinnedHostLatency, SIMTIME_S);
+        EV_INFO << "[LatencyAware-" << ScenarioTraits::name << "] Selecting MEC host: " << ScenarioTraits::pinnedHostName << "\n";
+
+        const MecHostRegistry& mecHosts = getMecHosts();
+        for (int i = 0; i < mecHosts.size(); i++) {
+            if (!strcmp(mecHosts[i].module->getName(), ScenarioTraits::pinnedHostName))
+                return mecHosts[i].module;
+        }
+        return nullptr;
+    }
+
+    cModule *findScoredHost(const ApplicationDescriptor& appDesc)
+    {
+        EV_INFO << "\n[LatencyAware-" << ScenarioTraits::name << "] Finding best MEC host\n";
+
+        ResourceDescriptor resources = appDesc.getVirtualResources();
+        const HostFeasibilityIndex::HostSet& candidates = mecOrchestrator_->findCandidateHosts(resources);
+        OrchestratorHosts hosts { this, resources, candidates, samplingRng };
+
+        // The hosts near the cell of the UE (if the orchestrator prunes them), d random feasible
+        // hosts, or all of them
+        const std::vector<int> *subset = mecOrchestrator_->findNearbyHosts(resources, candidates);
+        if (!subset && scorer.getNumChoices() > 0) {
+            subset = scorer.drawSample(hosts);
+            if (!subset)
+                EV_INFO << "[LatencyAware] No feasible host sampled, scoring all the hosts\n";
+        }
+
+        double bestScore, latency = 0.0;
+        int bestIndex = scorer.select(hosts, subset, bestScore, latency);
+        if (bestIndex < 0) {
+            EV_ERROR << "[LatencyAware] No suitable MEC host found\n";
+            return nullptr;
+        }
+
+        cModule *bestHost = getMecHosts()[bestIndex].module;
+        mecOrchestrator_->bestLatency = latency;
+        EV_INFO << "[LatencyAware] Selected host: " << bestHost->getName() << " with score " << bestScore
+                << " (latency=" << latency << ")\n";
+        return bestHost;
+    }
+};
+
+/*
+ * The LatencyAwareSelection of the named scenario ("best", "moderate" or "worst").
+ */
+inline SelectionPolicyBase *createLatencyAwareSelection(const char *scenario, MecOrchestrator *orchestrator,
+                                                        int numChoices = 0, int samplingRng = 0)
+{
+    SelectionPolicyBase *policy = nullptr;
+    withLatencyAwareScenario(scenario, [&](auto traits) {
+        policy = new LatencyAwareSelection<decltype(traits)>(orchestrator, numChoices, samplingRng);
+    });
+    return policy;
+}
+
+} // namespace simu5g
+
+#endif  // __SIMU5G_LATENCYAWARESELECTION_H_
@@ -0,0 +1,83 @@
+#ifndef __SIMU5G_MECAPPINSTANCEINDEX_H_
+#define __SIMU5G_MECAPPINSTANCEINDEX_H_
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <unordered_map>
+
+namespace simu5g {
+
+/**
+ * MecAppInstanceIndex
+ *
+ * Secondary index of the running MEC app contexts keyed by (UE app id, AppDId).
+ * The MecOrchestrator keeps it in sync with its context map so that the check for an
+ * already running instance on CREATE_CONTEXT_APP is a hash lookup instead of a scan
+ * over all the live contexts.
+ *
+ * The class does not depend on OMNeT++ so that it can be benchmarked standalone
+ * (see benchmarks/).
+ */
+class MecAppInstanceIndex
+{
+  public:
+    /*
+     * @return the context id of the instance running for the given UE app and
+     *         application descriptor, or -1 if there is none
+     */
+    int find(int ueAppID, const std::string& appDId) const
+    {
+        auto it = index_.find(Key{ ueAppID, appDId });
+        return it != index_.end() ? it->second : -1;
+    }
+
+    // Maps (ueAppID, appDId) to contextId, replacing any previous mapping
+    void insert(int ueAppID, const std::string& appDId, int contextId)
+    {
+        index_[Key{ ueAppID, appDId }] = contextId;
+    }
+
+    /*
+     * Removes the mapping of (ueAppID, appDId), but only if it still refers to
+     * contextId, so that removing an old context cannot drop a newer one.
+     *
+     * @return true if the mapping has been removed
+     */
+    bool erase(int ueAppID, const std::string& appDId, int contextId)
+    {
+        auto it = index_.find(Key{ ueAppID, appDId });
+        if (it == index_.end() || it->second != contextId)
+            return false;
+        index_.erase(it);
+        return true;
+    }
+
+    std::size_t size() const { return index_.size(); }
+    bool empty() const { return index_.empty(); }
+    void clear() { index_.clear(); }
+
+  private:
+    struct Key
+    {
+        int ueAppID;
+        std::string appDId;
+
+        bool operator==(const Key& other) const { return ueAppID == other.ueAppID && appDId == other.appDId; }
+    };
+
+    struct KeyHash
+    {
+        std::size_t operator()(const Key& key) const
+        {
+            std::size_t h = std::hash<std::string>()(key.appDId);
+            return h ^ (std::hash<int>()(key.ueAppID) + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2));
+        }
+    };
+
+    std::unordered_map<Key, int, KeyHash> index_;
+};
+
+} // namespace simu5g
+
+#endif  // __SIMU5G_MECAPPINSTANCEINDEX_H_
@@ -0,0 +1,59 @@
+//
+//                  Simu5G
+//
+// Authors: Giovanni Nardini, Giovanni Stea, Antonio Virdis (University of Pisa)
+//
+// This file is part of a software released under the license included in file
+// "license.pdf". Please read LICENSE and README files before using it.
+// The above files and the present reference are part of the software itself,
+// and cannot be removed from it.
+//
+
+#include "nodes/mec/MECOrchestrator/MecHostRegistry.h"
+
+namespace simu5g {
+
+MecHostDescriptor& MecHostRegistry::add(const MecHostDescriptor& descriptor)
+{
+    if (!descriptor.module)
+        throw cRuntimeError("MecHostRegistry::add - descriptor without MEC host module");
+
+    int hostId = descriptor.module->getId();
+    if (contains(hostId))
+        throw cRuntimeError("MecHostRegistry::add - MEC host %s already registered", descriptor.module->getFullPath().c_str());
+
+    int index = descriptors_.size();
+    descriptors_.push_back(std::make_unique<MecHostDescriptor>(descriptor));
+    descriptors_.back()->index = index;
+    modules_.push_back(descriptor.module);
+    indexById_[hostId] = index;
+    ++version_;
+
+    return *descriptors_.back();
+}
+
+bool MecHostRegistry::remove(int hostId)
+{
+    auto it = indexById_.find(hostId);
+    if (it == indexById_.end())
+        return false;
+
+    // swap with the last host to keep the storage dense
+    int index = it->second;
+    int last = descriptors_.size() - 1;
+    if (index != last) {
+        std::swap(descriptors_[index], descriptors_[last]);
+        std::swap(modules_[index], modules_[last]);
+        descriptors_[index]->index = index;
+        indexById_[modules_[index]->getId()] = index;
+    }
+
+    descriptors_.pop_back();
+    modules_.pop_back();
+    indexById_.erase(hostId);
+    ++version_;
+
+    return true;
+}
+
+} //namespace
@@ -0,0 +1,152 @@
+//
+//                  Simu5G
+//
+// Authors: Giovanni Nardini, Giovanni Stea, Antonio Virdis (University of Pisa)
+//
+// This file is part of a software released under the license included in file
+// "license.pdf". Please read LICENSE and README files before using it.
+// The above files and the present reference are part of the software itself,
+// and cannot be removed from it.
+//
+
+#ifndef __MECHOSTREGISTRY_H_
+#define __MECHOSTREGISTRY_H_
+
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include <omnetpp.h>
+#include <inet/networklayer/common/L3Address.h>
+
+#include "nodes/mec/MECOrchestrator/RttEstimator.h"
+#include "nodes/mec/MECOrchestrator/TrafficMeter.h"
+
+namespace simu5g {
+
+using namespace omnetpp;
+
+class VirtualisationInfrastructureManager;
+class MecPlatformManager;
+class ServiceRegistry;
+class ServiceInfo;
+
+//
+// Resource state of a MEC host, as last read from its VIM and MEC platform manager.
+// The orchestrator refreshes it only after a change has been published for the host
+// (see MecOrchestrator::getHostState()), so that selection does not poll the modules.
+//
+struct MecHostState
+{
+    double availableRam = 0.0;
+    double availableDisk = 0.0;
+    double availableCpu = 0.0;
+    double usedCpu = 0.0;                              // fraction of the CPU allocated
+    double availableBandwidth = 0.0;
+    double cpuLoad = 0.0;
+    const std::vector<ServiceInfo> *mecServices = nullptr;   // owned by the MEC platform manager
+
+    bool dirty = true;                                 // a change was published since the last refresh
+
+    // same test as VirtualisationInfrastructureManager::isAllocable()
+    bool isAllocable(double ram, double disk, double cpu) const
+    {
+        return ram < availableRam && disk < availableDisk && cpu < availableCpu;
+    }
+};
+
+//
+// Handles of the submodules of a MEC host, resolved once when the host joins the
+// MEC system so that selection and instantiation do not walk the module tree.
+//
+struct MecHostDescriptor
+{
+    cModule *module = nullptr;                         // the MEC host compound module
+    VirtualisationInfrastructureManager *vim = nullptr;
+    MecPlatformManager *mecpm = nullptr;
+    ServiceRegistry *serviceRegistry = nullptr;        // mecPlatform.serviceRegistry (if any)
+    cModule *nic = nullptr;                            // NIC and its queue (if any), for throughput/queue metrics
+    cModule *nicQueue = nullptr;
+    cModule *upfMec = nullptr;
+
+    // GTP address of upf_mec, resolved once the network is configured (not available at INITSTAGE_LOCAL)
+    inet::L3Address upfGtpAddress;
+
+    // latency to the host, from the hostLatencies parameter of the orchestrator (in seconds);
+    // for an expression entry (e.g. a distribution) this is its last sample
+    double latency = 0.0;
+    std::shared_ptr<cDynamicExpression> latencyExpression;
+
+    // measured RTT from each cell, indexed by the dense cell index of the orchestrator
+    // (empty until a probe reports a sample for this host)
+    std::vector<RttEstimator> rttByCell;
+
+    MecHostState state;                                // resource telemetry, see MecHostState
+
+    // live NIC traffic, fed by the packet signals of the NIC and its queue (bits)
+    WindowedRateMeter txMeter;                         // bits leaving the NIC queue
+    WindowedRateMeter rxMeter;                         // bits received by the NIC
+    QueueGauge queueGauge;                             // occupancy of the NIC queue
+
+    int index = -1;                                    // current position in the registry
+};
+
+//
+// MecHostRegistry
+//
+// The set of MEC hosts associated with the MEC system. It is owned by the MecOrchestrator
+// and shared by reference with the selection policies, so that they always see the
+// current host set without copying it.
+//
+//  - hosts can join and leave at run time
+//  - lookup by host module id is O(1)
+//  - hosts are stored densely (index 0..size()-1) for cache-friendly scans; removing a host
+//    moves the last one into its slot, so indices are only stable between membership changes
+//  - descriptors are heap-allocated, so pointers to them stay valid until the host leaves
+//
+class MecHostRegistry
+{
+  protected:
+    std::vector<std::unique_ptr<MecHostDescriptor>> descriptors_;
+    std::vector<cModule *> modules_;                   // index-aligned with descriptors_
+    std::unordered_map<int, int> indexById_;           // module id -> index
+    unsigned long version_ = 0;                        // bumped on every join/leave
+
+  public:
+    /*
+     * Adds a MEC host. Throws if the host is already registered.
+     *
+     * @return the stored descriptor
+     */
+    MecHostDescriptor& add(const MecHostDescriptor& descriptor);
+
+    /*
+     * Removes the MEC host with the given module id.
+     *
+     * @return false if the host is not registered
+     */
+    bool remove(int hostId);
+
+    const MecHostDescriptor *find(int hostId) const
+    {
+        auto it = indexById_.find(hostId);
+        return it != indexById_.end() ? descriptors_[it->second].get() : nullptr;
+    }
+    const MecHostDescriptor *find(const cModule *mecHost) const { return mecHost ? find(mecHost->getId()) : nullptr; }
+    bool contains(int hostId) const { return indexById_.count(hostId) != 0; }
+
+    int size() const { return descriptors_.size(); }
+    bool empty() const { return descriptors_.empty(); }
+    const MecHostDescriptor& operator[](int index) const { return *descriptors_[index]; }
+    MecHostDescriptor& operator[](int index) { return *descriptors_[index]; }
+
+    // host modules, index-aligned with the descriptors
+    const std::vector<cModule *>& getModules() const { return modules_; }
+
+    // allows users to detect membership changes since they last looked at the registry
+    unsigned long getVersion() const { return version_; }
+};
+
+} //namespace
+
+#endif
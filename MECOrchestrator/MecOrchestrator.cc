@@ -0,0 +1,1691 @@
+//
+//                  Simu5G
+//
+// Authors: Giovanni Nardini, Giovanni Stea, Antonio Virdis (University of Pisa)
+//
+// This file is part of a software released under the license included in file
+// "license.pdf". Please read LICENSE and README files before using it.
+// The above files and the present reference are part of the software itself,
+// and cannot be removed from it.
+//
+
+#include "nodes/mec/MECOrchestrator/MecOrchestrator.h"
+
+#include "nodes/mec/MECPlatformManager/MecPlatformManager.h"
+#include "nodes/mec/VirtualisationInfrastructureManager/VirtualisationInfrastructureManager.h"
+#include "nodes/mec/MECPlatform/ServiceRegistry/ServiceRegistry.h"
+
+#include "apps/mec/MecApps/MultiUEMECApp.h"
+
+#include <inet/common/ModuleAccess.h>
+#include <inet/mobility/contract/IMobility.h>
+
+#include "nodes/mec/MECOrchestrator/MECOMessages/MECOrchestratorMessages_m.h"
+#include "nodes/mec/UALCMP/UALCMPMessages/UALCMPMessages_m.h"
+#include "nodes/mec/UALCMP/UALCMPMessages/UALCMPMessages_types.h"
+#include "nodes/mec/UALCMP/UALCMPMessages/CreateContextAppMessage.h"
+#include "nodes/mec/UALCMP/UALCMPMessages/CreateContextAppAckMessage.h"
+
+// Selection policy headers
+#include "nodes/mec/MECOrchestrator/mecHostSelectionPolicies/MecServiceSelectionBased.h"
+#include "nodes/mec/MECOrchestrator/mecHostSelectionPolicies/AvailableResourcesSelectionBased.h"
+#include "nodes/mec/MECOrchestrator/mecHostSelectionPolicies/MecHostSelectionBased.h"
+#include "nodes/mec/MECOrchestrator/mecHostSelectionPolicies/LatencyAwareSelection.h"
+#include "nodes/mec/MECOrchestrator/LatencyAwareScenario.h"
+
+// Debug utilities
+#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+namespace simu5g {
+
+Define_Module(MecOrchestrator);
+
+MecOrchestrator::~MecOrchestrator()
+{
+    cancelAndDelete(admissionBatchTimer_);
+    for (UALCMPMessage *msg : pendingAdmissions_)
+        delete msg;
+}
+//-----------------------------------------------------------------------------
+// Initialization
+//-----------------------------------------------------------------------------
+void MecOrchestrator::initialize(int stage)
+{
+    cSimpleModule::initialize(stage);
+
+    // UPF addresses are only available once the network has been configured
+    if (stage == inet::INITSTAGE_LAST) {
+        for (int i = 0; i < mecHostRegistry_.size(); i++)
+            resolveMecHostUpfAddress(mecHostRegistry_[i]);
+
+        // base station ids are also assigned during the initialization
+        if (useTopologyLatency)
+            updateTopologyLatency();
+        return;
+    }
+
+    // Only run initialization logic at the local stage
+    if (stage != inet::INITSTAGE_LOCAL)
+        return;
+
+    EV << "MecOrchestrator::initialize - stage " << stage << endl;
+
+    // Reference to global binder module
+    binder_.reference(this, "binderModule", true);
+
+    taskDelaySignal = registerSignal("taskDelay");
+    selectedLatencySignal = registerSignal("selectedLatency");
+    packetLossSignal = registerSignal("packetLoss");
+    admissionBatchSizeSignal = registerSignal("admissionBatchSize");
+    admissionBatchGainSignal = registerSignal("admissionBatchGain");
+    admissionBatchLatencyGainSignal = registerSignal("admissionBatchLatencyGain");
+    recordStatistics = par("recordStatistics");
+    recordCounterfactuals_ = recordStatistics && par("recordCounterfactuals").boolValue();
+
+    // Measured RTT: samples of the probes emitting rttSignal anywhere in the network
+    rttAlpha = par("rttAlpha");
+    rttBeta = par("rttBeta");
+    rttVarianceWeight = par("rttVarianceWeight");
+    const char *rttSignalName = par("rttSignal");
+    if (*rttSignalName)
+        getSimulation()->getSystemModule()->subscribe(rttSignalName, this);
+
+    // Host telemetry: the MEC hosts are subscribed to when they join
+    const char *telemetrySignalName = par("telemetrySignal");
+    if (*telemetrySignalName)
+        telemetrySignal_ = registerSignal(telemetrySignalName);
+
+    unplaceableRequests_.setCapacity(par("unplaceableCacheSize").intValue());
+    spatialCandidates = par("spatialCandidates");
+
+    admissionBatchWindow = par("admissionBatchWindow").doubleValue();
+    admissionBatchTimer_ = new cMessage("admissionBatchTimer");
+
+    // NIC traffic meters: the MEC hosts are subscribed to when they join
+    trafficMeterWindow = par("trafficMeterWindow").doubleValue();
+    trafficMeterBuckets = par("trafficMeterBuckets");
+    auto registerOptionalSignal = [this](const char *parName) {
+        const char *signalName = par(parName);
+        return *signalName ? registerSignal(signalName) : SIMSIGNAL_NULL;
+    };
+    queueInSignal_ = registerOptionalSignal("queueInSignal");
+    queueOutSignal_ = registerOptionalSignal("queueOutSignal");
+    queueDropSignal_ = registerOptionalSignal("queueDropSignal");
+    nicRxSignal_ = registerOptionalSignal("nicRxSignal");
+
+    // Topology latency: computed at the last stage, kept up to date on model changes
+    useTopologyLatency = par("useTopologyLatency");
+    topologyPacketLength = par("topologyPacketLength").doubleValue();
+    if (useTopologyLatency)
+        getSimulation()->getSystemModule()->subscribe(POST_MODEL_CHANGE, this);
+
+    // Scenario of the run: its instantiation hooks here, its selection hooks in the LatencyAware policies
+    withLatencyAwareScenario(par("latencyAwareScenario"), [this](auto traits) {
+        using ScenarioTraits = decltype(traits);
+        scenarioFailureProbability_ = ScenarioTraits::failureProbability();
+        scenarioExtraDelay_ = ScenarioTraits::extraDelay();
+    });
+
+    // Retrieve and apply the MEC host selection policy
+    const char *selectionPolicyPar = par("selectionPolicy");
+    if (!strcmp(selectionPolicyPar, "MecServiceBased"))
+        mecHostSelectionPolicy_ = new MecServiceSelectionBased(this);
+    else if (!strcmp(selectionPolicyPar, "AvailableResourcesBased"))
+        mecHostSelectionPolicy_ = new AvailableResourcesSelectionBased(this);
+    else if (!strcmp(selectionPolicyPar, "MecHostBased"))
+        mecHostSelectionPolicy_ = new MecHostSelectionBased(this, par("mecHostIndex"));
+    else if (!strcmp(selectionPolicyPar, "LatencyAwareBased"))
+        mecHostSelectionPolicy_ = createLatencyAwareSelection(par("latencyAwareScenario"), this);
+    else if (!strcmp(selectionPolicyPar, "LatencyAwareSampled"))
+        mecHostSelectionPolicy_ = createLatencyAwareSelection(par("latencyAwareScenario"), this, par("sampledChoices"), par("samplingRng"));
+    else
+        throw cRuntimeError("MecOrchestrator::initialize - Unknown selection policy: '%s'", selectionPolicyPar);
+
+    // Load operational timing parameters
+    onboardingTime = par("onboardingTime").doubleValue();
+    instantiationTime = par("instantiationTime").doubleValue();
+    terminationTime = par("terminationTime").doubleValue();
+
+    // Initialize connected MEC hosts and onboard available application packages
+    getConnectedMecHosts();
+    onboardApplicationPackages();
+}
+//-----------------------------------------------------------------------------
+// Message Dispatcher
+//-----------------------------------------------------------------------------
+void MecOrchestrator::handleMessage(cMessage *msg)
+{
+    // the admission batch timer is reused, it is not deleted below
+    if (msg == admissionBatchTimer_) {
+        flushAdmissionBatch();
+        return;
+    }
+
+    if (msg->isSelfMessage()) {
+        // Handle internally scheduled orchestration messages
+        if (strcmp(msg->getName(), "MECOrchestratorMessage") == 0) {
+            EV << "MecOrchestrator::handleMessage - internal event: " << msg->getName() << endl;
+
+            auto *meoMsg = check_and_cast<MECOrchestratorMessage *>(msg);
+            if (!strcmp(meoMsg->getType(), CREATE_CONTEXT_APP)) {
+                // Completion of context creation
+                if (meoMsg->getSuccess())
+                    sendCreateAppContextAck(true, meoMsg->getRequestId(), meoMsg->getContextId());
+                else
+                    sendCreateAppContextAck(false, meoMsg->getRequestId());
+            }
+            else if (!strcmp(meoMsg->getType(), DELETE_CONTEXT_APP)) {
+                // Completion of context deletion
+                sendDeleteAppContextAck(meoMsg->getSuccess(), meoMsg->getRequestId(), meoMsg->getContextId());
+            }
+        }
+    }
+    else if (msg->arrivedOn("fromUALCMP")) {
+        // Handle requests from the UALCMP module (LCM proxy)
+        EV << "MecOrchestrator::handleMessage - received from UALCMP: " << msg->getName() << endl;
+        handleUALCMPMessage(msg);
+    }
+
+    // Clean up
+    delete msg;
+}
+//-----------------------------------------------------------------------------
+// Run-time Parameter Changes
+//-----------------------------------------------------------------------------
+void MecOrchestrator::handleParameterChange(const char *parname)
+{
+    // The latency table is resolved into the host descriptors
+    if (!parname || !strcmp(parname, "hostLatencies") || !strcmp(parname, "defaultHostLatency")) {
+        for (int i = 0; i < mecHostRegistry_.size(); i++)
+            resolveHostLatency(mecHostRegistry_[i]);
+    }
+
+    if (!parname || !strcmp(parname, "rttAlpha") || !strcmp(parname, "rttBeta") || !strcmp(parname, "rttVarianceWeight")) {
+        rttAlpha = par("rttAlpha");
+        rttBeta = par("rttBeta");
+        rttVarianceWeight = par("rttVarianceWeight");
+    }
+
+    if (!parname || !strcmp(parname, "topologyPacketLength")) {
+        topologyPacketLength = par("topologyPacketLength").doubleValue();
+        topologyLatencyDirty_ = true;
+    }
+
+    // Let the selection policy refresh the parameters it caches
+    if (mecHostSelectionPolicy_)
+        mecHostSelectionPolicy_->handleParameterChange(parname);
+}
+//-----------------------------------------------------------------------------
+// Statistics
+//-----------------------------------------------------------------------------
+void MecOrchestrator::finish()
+{
+    // Footprint of the MEC app context storage, per context at its peak occupancy
+    double peakContexts = meAppMap.getPeakSize();
+    recordScalar("mecAppContextPeakCount", peakContexts);
+    recordScalar("mecAppContextStorage", meAppMap.memoryUsage(), "B");
+    recordScalar("mecAppContextMemoryPerContext", peakContexts > 0 ? meAppMap.memoryUsage() / peakContexts : 0.0, "B");
+
+    recordScalar("rttSamples", rttSamples_);
+    recordScalar("rttSamplesIgnored", rttSamplesIgnored_);
+    recordScalar("rttCells", cellIndex_.size());
+    if (useTopologyLatency)
+        recordScalar("topologyLatencyUpdates", topologyLatencyUpdates_);
+
+    // published resource changes vs. actual reads of the VIM/MEC platform manager
+    recordScalar("telemetryNotifications", telemetryNotifications_);
+    recordScalar("telemetryUpdates", telemetryUpdates_);
+    recordScalar("hostStateReads", hostStateReads_);
+    recordScalar("unplaceableFastFails", unplaceableFastFails_);
+    if (scenarioFailureProbability_ > 0)
+        recordScalar("scenarioForcedFailures", scenarioForcedFailures_);
+    if (spatialCandidates > 0) {
+        recordScalar("spatialDecisions", spatialDecisions_);
+        recordScalar("spatialScoredHosts", spatialScoredHosts_);
+    }
+    recordScalar("reservationCommits", reservationCommits_);
+    recordScalar("reservationRollbacks", reservationRollbacks_);
+    if (recordCounterfactuals_) {
+        recordScalar("reservedDecisions", reservedDecisions_);
+        recordScalar("reservationChangedDecisions", reservationChangedDecisions_);
+    }
+    if (admissionBatchWindow > 0) {
+        recordScalar("admissionBatches", admissionBatches_);
+        recordScalar("admissionBatchedRequests", admissionBatchedRequests_);
+        if (recordCounterfactuals_)
+            recordScalar("admissionBatchGain", admissionBatchGain_);
+    }
+
+    for (int i = 0; i < mecHostRegistry_.size(); i++) {
+        const MecHostDescriptor& hostDesc = mecHostRegistry_[i];
+        if (hostDesc.nicQueue)
+            recordScalar((std::string("nicQueuePeakBitLength:") + hostDesc.module->getFullName()).c_str(), hostDesc.queueGauge.getPeakBitLength(), "b");
+    }
+
+    if (recordStatistics) {
+        recordQuantiles("taskDelay", taskDelaySketch_, "s");
+        recordQuantiles("selectedLatency", selectedLatencySketch_, "s");
+        if (admissionBatchWindow > 0)
+            recordQuantiles("admissionSolveWallClock", admissionSolveWallClockSketch_, "s");
+
+#if SIMU5G_STAGE_TIMING
+        recordQuantiles("selectionWallClock", stageProfile_.getSketch(StageProfile::SELECT), "s");
+        for (int i = 0; i < StageProfile::NUM_STAGES; i++) {
+            auto stage = static_cast<StageProfile::Stage>(i);
+            std::string name = std::string("stage.") + StageProfile::getName(stage);
+            recordQuantiles(name.c_str(), stageProfile_.getSketch(stage), "s");
+            recordScalar((name + ":total").c_str(), stageProfile_.getSketch(stage).getSum(), "s");
+        }
+#endif
+    }
+}
+
+void MecOrchestrator::recordQuantiles(const char *name, const QuantileSketch& sketch, const char *unit)
+{
+    std::string prefix(name);
+    recordScalar((prefix + ":count").c_str(), sketch.getCount());
+    if (sketch.getCount() == 0)
+        return;
+
+    recordScalar((prefix + ":p50").c_str(), sketch.getQuantile(0.5), unit);
+    recordScalar((prefix + ":p90").c_str(), sketch.getQuantile(0.9), unit);
+    recordScalar((prefix + ":p99").c_str(), sketch.getQuantile(0.99), unit);
+    recordScalar((prefix + ":p99.9").c_str(), sketch.getQuantile(0.999), unit);
+    recordScalar((prefix + ":max").c_str(), sketch.getMax(), unit);
+}
+//-----------------------------------------------------------------------------
+// UALCMP Message Routing
+//-----------------------------------------------------------------------------
+void MecOrchestrator::handleUALCMPMessage(cMessage *msg)
+{
+    auto *lcmMsg = check_and_cast<UALCMPMessage *>(msg);
+
+    // Process application context creation
+    if (!strcmp(lcmMsg->getType(), CREATE_CONTEXT_APP)) {
+        // Triggers selection and instantiation, at once or with the other requests of the window
+        if (admissionBatchWindow > 0)
+            enqueueAdmission(lcmMsg);
+        else
+            startMECApp(lcmMsg);
+    }
+    // Process application context deletion
+    else if (!strcmp(lcmMsg->getType(), DELETE_CONTEXT_APP)) {
+        stopMECApp(lcmMsg);   // Triggers termination and cleanup
+    }
+}
+
+
+
+//-----------------------------------------------------------------------------
+// Batched admission
+//-----------------------------------------------------------------------------
+void MecOrchestrator::enqueueAdmission(UALCMPMessage *msg)
+{
+    contextStartTimes.emplace(msg->getRequestId(), simTime());
+    pendingAdmissions_.push_back(check_and_cast<UALCMPMessage *>(msg->dup()));
+    if (!admissionBatchTimer_->isScheduled())
+        scheduleAfter(admissionBatchWindow, admissionBatchTimer_);
+}
+
+void MecOrchestrator::flushAdmissionBatch()
+{
+    std::vector<UALCMPMessage *> batch;
+    batch.swap(pendingAdmissions_);
+
+    // Requests for a running app or an unknown descriptor are left to startMECApp()
+    std::vector<AdmissionRequest> requests;
+    for (UALCMPMessage *msg : batch) {
+        CreateContextAppMessage *contAppMsg = check_and_cast<CreateContextAppMessage *>(msg);
+        if (mecAppInstanceIndex_.find(atoi(contAppMsg->getDevAppId()), contAppMsg->getAppDId()) != -1)
+            continue;
+
+        const ApplicationDescriptor *desc = nullptr;
+        if (!contAppMsg->getOnboarded()) {
+            desc = &onboardApplicationPackage(contAppMsg->getAppPackagePath());
+        }
+        else {
+            auto it = mecApplicationDescriptors_.find(contAppMsg->getAppDId());
+            if (it != mecApplicationDescriptors_.end())
+                desc = &it->second;
+        }
+        if (!desc)
+            continue;
+
+        requests.push_back({ msg->getRequestId(), desc, desc->getVirtualResources(), findRequestCell(contAppMsg->getUeIpAddress()) });
+    }
+
+    if (!requests.empty()) {
+        if (useTopologyLatency)
+            updateTopologyLatency();
+        expireTrafficMeters();
+
+        // First-fit decreasing: the largest demands are placed while the hosts have most room
+        std::vector<int> arrivalOrder(requests.size());
+        for (int i = 0; i < (int)requests.size(); i++)
+            arrivalOrder[i] = i;
+        std::vector<int> order = arrivalOrder;
+        std::stable_sort(order.begin(), order.end(), [&requests](int a, int b) {
+            const ResourceDescriptor& ra = requests[a].resources;
+            const ResourceDescriptor& rb = requests[b].resources;
+            if (ra.cpu != rb.cpu)
+                return ra.cpu > rb.cpu;
+            if (ra.ram != rb.ram)
+                return ra.ram > rb.ram;
+            return ra.disk > rb.disk;
+        });
+
+        double latencySum = 0;
+        auto solveStart = std::chrono::steady_clock::now();
+        int placed = placeAdmissionBatch(requests, order, &admissionPlan_, latencySum);
+        double solveTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - solveStart).count();
+
+        ++admissionBatches_;
+        admissionBatchedRequests_ += requests.size();
+        emit(admissionBatchSizeSignal, (long)requests.size());
+        if (recordStatistics)
+            admissionSolveWallClockSketch_.collect(solveTime);
+
+        // Quality gain over placing the same requests one by one, in arrival order (a second
+        // solve drawing its own random numbers, see recordCounterfactuals)
+        if (recordCounterfactuals_) {
+            double arrivalLatencySum = 0;
+            int arrivalPlaced = placeAdmissionBatch(requests, arrivalOrder, nullptr, arrivalLatencySum);
+            admissionBatchGain_ += placed - arrivalPlaced;
+            emit(admissionBatchGainSignal, (long)(placed - arrivalPlaced));
+            if (placed > 0 && arrivalPlaced > 0)
+                emit(admissionBatchLatencyGainSignal, arrivalLatencySum / arrivalPlaced - latencySum / placed);
+            EV << "MecOrchestrator::flushAdmissionBatch - " << arrivalPlaced << " placed in arrival order" << endl;
+        }
+
+        EV << "MecOrchestrator::flushAdmissionBatch - " << requests.size() << " requests, " << placed << " placed" << endl;
+    }
+
+    // Carry out the placements (and the other requests) in arrival order
+    for (UALCMPMessage *msg : batch) {
+        startMECApp(msg);
+        delete msg;
+    }
+    admissionPlan_.clear();
+}
+
+int MecOrchestrator::placeAdmissionBatch(const std::vector<AdmissionRequest>& requests, const std::vector<int>& order,
+                                         std::unordered_map<unsigned int, AdmissionPlacement> *plan, double& latencySum)
+{
+    int placed = 0;
+    latencySum = 0;
+    for (int r : order) {
+        const AdmissionRequest& request = requests[r];
+        cModule *host = nullptr;
+        if (!unplaceableRequests_.contains(request.resources.ram, request.resources.disk, request.resources.cpu)) {
+            requestCell_ = request.cell;
+            host = plan ? selectMecHost(*request.desc) : mecHostSelectionPolicy_->findBestMecHost(*request.desc);
+        }
+        if (plan)
+            (*plan)[request.requestId] = { host, request.desc };
+
+        const MecHostDescriptor *hostDesc = mecHostRegistry_.find(host);
+        if (!hostDesc)
+            continue;
+        ++placed;
+        latencySum += getHostLatency(hostDesc->index);
+        reserveHostResources(request.requestId, hostDesc->index, request.resources);
+    }
+
+    // the reservations only hold for the placement (startMECApp() reserves again)
+    for (const AdmissionRequest& request : requests) {
+        int host = reservations_.rollback(request.requestId);
+        if (host >= 0)
+            invalidateHostState(host);
+    }
+    return placed;
+}
+
+void MecOrchestrator::reserveHostResources(unsigned int requestId, int hostIndex, const ResourceDescriptor& resources)
+{
+    MecHostDescriptor& hostDesc = mecHostRegistry_[hostIndex];
+    getHostState(hostIndex);  // up to date before the reservation
+    reservations_.reserve(requestId, hostIndex, resources.ram, resources.disk, resources.cpu);
+
+    // the state is kept as VIM minus reservations, as refreshHostState() computes it
+    MecHostState& state = hostDesc.state;
+    if (state.availableCpu > 0)
+        state.usedCpu = std::min(state.usedCpu + (1 - state.usedCpu) * resources.cpu / state.availableCpu, 1.0);
+    state.availableRam -= resources.ram;
+    state.availableDisk -= resources.disk;
+    state.availableCpu -= resources.cpu;
+
+    feasibility_.setAvailable(hostIndex, state.availableRam, state.availableDisk, state.availableCpu);
+    notifyHostChange(hostIndex);
+}
+
+void MecOrchestrator::commitHostReservation(unsigned int requestId)
+{
+    int host = reservations_.commit(requestId);
+    if (host < 0)
+        return;
+    ++reservationCommits_;
+    invalidateHostState(host);
+}
+
+void MecOrchestrator::rollbackHostReservation(unsigned int requestId)
+{
+    int host = reservations_.rollback(requestId);
+    if (host < 0)
+        return;
+    ++reservationRollbacks_;
+    invalidateHostState(host);
+    unplaceableRequests_.clear();  // the resources are available again
+}
+
+cModule *MecOrchestrator::selectMecHost(const ApplicationDescriptor& desc)
+{
+    cModule *host = mecHostSelectionPolicy_->findBestMecHost(desc);
+    if (reservations_.empty() || !recordCounterfactuals_)
+        return host;
+
+    // Same decision on the VIM values alone (the reserved hosts are read again both ways).
+    // Not side-effect free: the policy draws its random numbers again
+    ++reservedDecisions_;
+    auto invalidateReservedHosts = [this]() {
+        reservations_.forEachReservedHost([this](int i) { invalidateHostState(i); });
+    };
+    ignoreReservations_ = true;
+    invalidateReservedHosts();
+    cModule *unreservedHost = mecHostSelectionPolicy_->findBestMecHost(desc);
+    ignoreReservations_ = false;
+    invalidateReservedHosts();
+
+    if (unreservedHost != host)
+        ++reservationChangedDecisions_;
+    return host;
+}
+
+void MecOrchestrator::startMECApp(UALCMPMessage *msg)
+{
+    // Cast and extract request parameters
+    CreateContextAppMessage *contAppMsg = check_and_cast<CreateContextAppMessage *>(msg);
+    unsigned int requestSno = msg->getRequestId();
+    int contextId = meAppMap.nextId();  // the id addMecAppContext() will allocate on success
+
+    // the requests of an admission batch come with their placement (see flushAdmissionBatch())
+    auto planned = admissionPlan_.find(requestSno);
+    bool isPlanned = planned != admissionPlan_.end();
+    AdmissionPlacement placement;
+    if (isPlanned) {
+        placement = planned->second;
+        admissionPlan_.erase(planned);
+    }
+    contextStartTimes.emplace(requestSno, simTime());  // batched requests keep their arrival time
+
+    EV << "MecOrchestrator::createMeApp - processing... request id: " << requestSno << endl;
+
+    // Retrieve UE App ID
+    int ueAppID = atoi(contAppMsg->getDevAppId());
+
+    //--------------------------------------------------------------------------
+    // Check if the MEC App is already running
+    //--------------------------------------------------------------------------
+    int runningContextId = mecAppInstanceIndex_.find(ueAppID, contAppMsg->getAppDId());
+    if (runningContextId != -1) {
+        const mecAppMapEntry& contextApp = *meAppMap.find(runningContextId);
+        EV << "MecOrchestrator::startMECApp - WARNING: App already running on MEC host: "
+           << contextApp.mecHost->getName() << endl;
+        EV << "MecOrchestrator::startMECApp - Sending ACK for existing context.\n";
+        sendCreateAppContextAck(true, requestSno, runningContextId);
+
+        // If app supports multiple UEs, notify it
+        auto* existingMECApp = dynamic_cast<MultiUEMECApp*>(contextApp.reference);
+        if (existingMECApp) {
+            UE_MEC_CLIENT newUE;
+            newUE.address = inet::L3Address(contAppMsg->getUeIpAddress());
+            newUE.port = -1;  // Unknown at this stage
+            existingMECApp->addNewUE(newUE);
+        }
+        return;
+    }
+
+    //--------------------------------------------------------------------------
+    // Handle application descriptor onboarding if needed
+    //--------------------------------------------------------------------------
+    std::string appDid;
+    double processingTime = 0.0;
+
+    if (isPlanned) {
+        // onboarded by flushAdmissionBatch(), the onboarding time is still due
+        appDid = placement.desc->getAppDId();
+        if (!contAppMsg->getOnboarded())
+            processingTime += onboardingTime;
+    }
+    else if (!contAppMsg->getOnboarded()) {
+        EV << "MecOrchestrator::startMECApp - Onboarding app from: "
+           << contAppMsg->getAppPackagePath() << endl;
+        const ApplicationDescriptor& appDesc = onboardApplicationPackage(contAppMsg->getAppPackagePath());
+        appDid = appDesc.getAppDId();
+        processingTime += onboardingTime;
+    } else {
+        appDid = contAppMsg->getAppDId();
+    }
+
+    // Check that the descriptor is available
+    auto it = mecApplicationDescriptors_.find(appDid);
+    if (it == mecApplicationDescriptors_.end()) {
+        EV << "MecOrchestrator::startMECApp - AppDId [" << appDid << "] not found.\n";
+        sendCreateAppContextAck(false, requestSno);
+        return;
+    }
+
+    const ApplicationDescriptor& desc = it->second;
+    ResourceDescriptor resources = desc.getVirtualResources();
+
+    //--------------------------------------------------------------------------
+    // Select MEC Host using configured policy
+    //--------------------------------------------------------------------------
+    cModule *bestHost = nullptr;
+    if (isPlanned) {
+        EV << "MecOrchestrator::startMECApp - placed by the admission batch" << endl;
+        requestCell_ = findRequestCell(contAppMsg->getUeIpAddress());
+        bestHost = placement.host;
+        if (!bestHost && isUnplaceable(resources))
+            unplaceableRequests_.add(resources.ram, resources.disk, resources.cpu);
+    }
+    else if (unplaceableRequests_.contains(resources.ram, resources.disk, resources.cpu)) {
+        // no host could allocate these resources, and none has been released since
+        EV << "MecOrchestrator::startMECApp - resources known to be unplaceable, skipping the selection" << endl;
+        ++unplaceableFastFails_;
+    }
+    else {
+        // measured and topology latencies are looked up for the cell serving the UE
+        if (useTopologyLatency)
+            updateTopologyLatency();
+        requestCell_ = findRequestCell(contAppMsg->getUeIpAddress());
+        expireTrafficMeters();
+        {
+            STAGE_TIMER(stageProfile_, SELECT);
+            bestHost = selectMecHost(desc);
+        }
+
+        // policies can also fail for other reasons (e.g. a missing MEC service): remember resource failures only
+        if (!bestHost && isUnplaceable(resources))
+            unplaceableRequests_.add(resources.ram, resources.disk, resources.cpu);
+    }
+
+    //--------------------------------------------------------------------------
+    // Instantiate MEC Application on selected host
+    //--------------------------------------------------------------------------
+    if (bestHost != nullptr) {
+        // Scenario instantiation hooks: forced failure (on RNG 0), extra delay
+        if (scenarioFailureProbability_ > 0 && uniform(0, 1) < scenarioFailureProbability_) {
+            EV_WARN << "MecOrchestrator::startMECApp - forced MEC App instantiation failure" << endl;
+            ++scenarioForcedFailures_;
+            auto *msg = new MECOrchestratorMessage("MECOrchestratorMessage");
+            msg->setType(CREATE_CONTEXT_APP);
+            msg->setRequestId(requestSno);
+            msg->setSuccess(false);
+            scheduleAt(simTime() + scenarioExtraDelay_, msg);
+            bestLatency = SIMTIME_ZERO;
+            return;
+        }
+        processingTime += scenarioExtraDelay_.dbl();
+
+        bestLatency = computeLatencyForHost(bestHost);
+        emit(selectedLatencySignal, bestLatency);
+        if (recordStatistics)
+            selectedLatencySketch_.collect(bestLatency.dbl());
+
+        CreateAppMessage *createAppMsg = new CreateAppMessage();
+        createAppMsg->setUeAppID(ueAppID);
+        createAppMsg->setMEModuleName(desc.getAppName().c_str());
+        createAppMsg->setMEModuleType(desc.getAppProvider().c_str());
+        createAppMsg->setRequiredCpu(resources.cpu);
+        createAppMsg->setRequiredRam(resources.ram);
+        createAppMsg->setRequiredDisk(resources.disk);
+        createAppMsg->setRequiredService(
+            desc.getOmnetppServiceRequired().empty() ? "NULL" : desc.getOmnetppServiceRequired().c_str()
+        );
+        createAppMsg->setContextId(contextId);
+
+        //--------------------------------------------------------------------------
+        // Setup internal tracking structures
+        //--------------------------------------------------------------------------
+        mecAppMapEntry newMecApp;
+        newMecApp.appDId = appDid;
+        newMecApp.mecUeAppID = ueAppID;
+        newMecApp.mecHost = bestHost;
+        {
+            STAGE_TIMER(stageProfile_, RESOLVE);
+            newMecApp.ueAddress = inet::L3AddressResolver().resolve(contAppMsg->getUeIpAddress());
+        }
+        const MecHostDescriptor *hostDesc = mecHostRegistry_.find(bestHost);
+        if (!hostDesc)
+            throw cRuntimeError("MecOrchestrator::startMECApp - MEC host %s is not connected to the orchestrator", bestHost->getFullPath().c_str());
+        reserveHostResources(requestSno, hostDesc->index, resources);
+        newMecApp.hostDescriptor = hostDesc;
+        newMecApp.vim = hostDesc->vim;
+        newMecApp.mecpm = hostDesc->mecpm;
+        newMecApp.mecAppName = desc.getAppName().c_str();
+
+        MecPlatformManager *mecpm = hostDesc->mecpm;
+
+        //--------------------------------------------------------------------------
+        // Deploy app based on emulation mode
+        //--------------------------------------------------------------------------
+        MecAppInstanceInfo *appInfo = nullptr;
+        if (desc.isMecAppEmulated()) {
+            STAGE_TIMER(stageProfile_, INSTANTIATE);
+            EV << "MecOrchestrator::startMECApp - Emulated MEC App\n";
+            bool result = mecpm->instantiateEmulatedMEApp(createAppMsg);
+            markHostStateDirty(*hostDesc);
+            appInfo = new MecAppInstanceInfo();
+            appInfo->status = result;
+            appInfo->endPoint.addr = inet::L3Address(desc.getExternalAddress().c_str());
+            appInfo->endPoint.port = desc.getExternalPort();
+            appInfo->instanceId = "emulated_" + desc.getAppName();
+            newMecApp.isEmulated = true;
+
+            // Register MEC app address to UPF via binder
+            binder_->registerMecHostUpfAddress(appInfo->endPoint.addr, hostDesc->upfGtpAddress);
+        }
+        else {
+            STAGE_TIMER(stageProfile_, INSTANTIATE);
+            appInfo = mecpm->instantiateMEApp(createAppMsg);
+            markHostStateDirty(*hostDesc);
+            newMecApp.isEmulated = false;
+        }
+
+        // the VIM accounts for the resources of a running app
+        if (appInfo->status)
+            commitHostReservation(requestSno);
+        else
+            rollbackHostReservation(requestSno);
+
+        //--------------------------------------------------------------------------
+        // Instantiation failed
+        //--------------------------------------------------------------------------
+        if (!appInfo->status) {
+            EV << "MecOrchestrator::startMECApp - MEC App instantiation failed.\n";
+            auto *msg = new MECOrchestratorMessage("MECOrchestratorMessage");
+            msg->setType(CREATE_CONTEXT_APP);
+            msg->setRequestId(requestSno);
+            msg->setSuccess(false);
+            processingTime += instantiationTime;
+            scheduleAt(simTime() + processingTime, msg);
+            delete appInfo;
+            return;
+        }
+
+        //--------------------------------------------------------------------------
+        // Success: finalize context creation and register
+        //--------------------------------------------------------------------------
+        EV << "MecOrchestrator::startMECApp - App [" << appInfo->instanceId
+           << "] deployed at " << appInfo->endPoint.addr.str() << ":"
+           << appInfo->endPoint.port << endl;
+
+        auto *msg = new MECOrchestratorMessage("MECOrchestratorMessage");
+        msg->setContextId(contextId);
+        msg->setType(CREATE_CONTEXT_APP);
+        msg->setRequestId(requestSno);
+        msg->setSuccess(true);
+
+        newMecApp.mecAppAddress = appInfo->endPoint.addr;
+        newMecApp.mecAppPort = appInfo->endPoint.port;
+        newMecApp.mecAppInstanceId = appInfo->instanceId;
+        newMecApp.contextId = contextId;
+        newMecApp.reference = appInfo->reference;
+        addMecAppContext(newMecApp);
+
+        processingTime += instantiationTime;
+        scheduleAt(simTime() + processingTime, msg);
+
+        delete appInfo;
+    }
+    else {
+        //--------------------------------------------------------------------------
+        // No host selected: the failure is acknowledged after half an instantiation
+        //--------------------------------------------------------------------------
+        EV << "MecOrchestrator::startMECApp - No suitable host found.\n";
+        auto *msg = new MECOrchestratorMessage("MECOrchestratorMessage");
+        msg->setType(CREATE_CONTEXT_APP);
+        msg->setRequestId(requestSno);
+        msg->setSuccess(false);
+        processingTime += instantiationTime / 2;  // Retry opportunity implied
+        scheduleAt(simTime() + processingTime, msg);
+        bestLatency = SIMTIME_ZERO;
+    }
+}
+
+
+void MecOrchestrator::stopMECApp(UALCMPMessage *msg)
+{
+    EV << "MecOrchestrator::stopMECApp - processing..." << endl;
+
+    //--------------------------------------------------------------------------
+    // Validate and cast the incoming delete message
+    //--------------------------------------------------------------------------
+    auto *contAppMsg = dynamic_cast<DeleteContextAppMessage *>(msg);
+    if (!contAppMsg)
+        throw cRuntimeError("Invalid cast to DeleteContextAppMessage");
+
+    int contextId = contAppMsg->getContextId();
+    EV << "MecOrchestrator::stopMECApp - processing contextId: " << contextId << endl;
+
+    //--------------------------------------------------------------------------
+    // Check if the context exists before proceeding
+    //--------------------------------------------------------------------------
+    const mecAppMapEntry *contextApp = meAppMap.find(contextId);
+    if (!contextApp) {
+        if (meAppMap.isStale(contextId))
+            EV_WARN << "MecOrchestrator::stopMECApp - contextId [" << contextId << "] is stale, its MEC App has already been deleted" << endl;
+        else
+            EV << "MecOrchestrator::stopMECApp - WARNING: MEC App [" << contextId << "] not found!" << endl;
+        sendDeleteAppContextAck(false, contAppMsg->getRequestId(), contextId);
+        return;
+    }
+
+    //--------------------------------------------------------------------------
+    // Deallocate resources through MEC platform manager (PM) and VIM
+    //--------------------------------------------------------------------------
+    MecPlatformManager *mecpm = contextApp->hostDescriptor->mecpm;
+    DeleteAppMessage *deleteAppMsg = new DeleteAppMessage();
+    deleteAppMsg->setUeAppID(contextApp->mecUeAppID);
+
+    //--------------------------------------------------------------------------
+    // Terminate the application depending on whether it is emulated
+    //--------------------------------------------------------------------------
+    bool isTerminated;
+    if (contextApp->isEmulated) {
+        isTerminated = mecpm->terminateEmulatedMEApp(deleteAppMsg);
+        std::cout << "terminateEmulatedMEApp with result: " << isTerminated << std::endl;
+    } else {
+        isTerminated = mecpm->terminateMEApp(deleteAppMsg);
+    }
+    markHostStateDirty(*contextApp->hostDescriptor);
+    unplaceableRequests_.clear();  // resources released
+
+    //--------------------------------------------------------------------------
+    // Prepare and send orchestrator's acknowledgment message
+    //--------------------------------------------------------------------------
+    MECOrchestratorMessage *mecoMsg = new MECOrchestratorMessage("MECOrchestratorMessage");
+    mecoMsg->setType(DELETE_CONTEXT_APP);
+    mecoMsg->setRequestId(contAppMsg->getRequestId());
+    mecoMsg->setContextId(contextId);
+
+    if (isTerminated) {
+        EV << "MecOrchestrator::stopMECApp - MEC App [" << contextApp->mecUeAppID << "] removed successfully." << endl;
+        removeMecAppContext(contextId);
+        mecoMsg->setSuccess(true);
+    } else {
+        EV << "MecOrchestrator::stopMECApp - MEC App [" << contextApp->mecUeAppID << "] could not be removed." << endl;
+        mecoMsg->setSuccess(false);
+    }
+
+    //--------------------------------------------------------------------------
+    // Simulate moderate processing delay before confirming deletion
+    //--------------------------------------------------------------------------
+    double processingTime = terminationTime;
+    scheduleAt(simTime() + processingTime, mecoMsg);
+}
+
+
+void MecOrchestrator::sendDeleteAppContextAck(bool result, unsigned int requestSno, int contextId)
+{
+    EV << "MecOrchestrator::sendDeleteAppContextAck - result: "
+       << result << " reqSno: " << requestSno << " contextId: " << contextId << endl;
+
+    DeleteContextAppAckMessage *ack = new DeleteContextAppAckMessage();
+    ack->setType(ACK_DELETE_CONTEXT_APP);
+    ack->setRequestId(requestSno);
+    ack->setSuccess(result);
+
+    send(ack, "toUALCMP");
+}
+
+
+void MecOrchestrator::sendCreateAppContextAck(bool result, unsigned int requestSno, int contextId)
+{
+    STAGE_TIMER(stageProfile_, ACK);
+    EV << "MecOrchestrator::sendCreateAppContextAck - result: "
+       << result << " reqSno: " << requestSno << " contextId: " << contextId << endl;
+
+    CreateContextAppAckMessage *ack = new CreateContextAppAckMessage();
+    ack->setType(ACK_CREATE_CONTEXT_APP);
+
+    if (result) {
+        //--------------------------------------------------------------------------
+        // Verify again that the context exists before responding
+        //--------------------------------------------------------------------------
+        const mecAppMapEntry *mecAppStatus = meAppMap.find(contextId);
+        if (!mecAppStatus) {
+            EV << "MecOrchestrator::sendCreateAppContextAck - ERROR: meApp[" << contextId << "] does not exist!" << endl;
+            contextStartTimes.erase(requestSno);  // no ack will be sent for this request
+            delete ack;
+            return;
+        }
+
+        ack->setSuccess(true);
+        ack->setContextId(contextId);
+        ack->setAppInstanceId(mecAppStatus->mecAppInstanceId.c_str());
+        ack->setRequestId(requestSno);
+
+        // Construct instance URI in format: IP:Port
+        std::stringstream uri;
+        uri << mecAppStatus->mecAppAddress.str() << ":" << mecAppStatus->mecAppPort;
+        ack->setAppInstanceUri(uri.str().c_str());
+    }
+    else {
+        ack->setRequestId(requestSno);
+        ack->setSuccess(false);
+    }
+
+    // Task delay, from the arrival of the request to its (first) ack. A failed request is
+    // counted once, on its first ack: the entry is gone for any later one
+    auto startTime = contextStartTimes.find(requestSno);
+    if (startTime != contextStartTimes.end()) {
+        lastDelay = simTime() - startTime->second;
+        emit(taskDelaySignal, lastDelay);
+        if (recordStatistics)
+            taskDelaySketch_.collect(lastDelay.dbl());
+        if (!result)
+            emit(packetLossSignal, 1);
+        contextStartTimes.erase(startTime);
+    }
+
+    send(ack, "toUALCMP");
+}
+
+
+int MecOrchestrator::addMecAppContext(const mecAppMapEntry& entry)
+{
+    int contextId = meAppMap.insert(entry);
+    if (contextId != entry.contextId)
+        throw cRuntimeError("MecOrchestrator::addMecAppContext - context id %d expected, %d allocated", entry.contextId, contextId);
+
+    mecAppInstanceIndex_.insert(entry.mecUeAppID, entry.appDId, contextId);
+    return contextId;
+}
+
+
+void MecOrchestrator::removeMecAppContext(int contextId)
+{
+    const mecAppMapEntry *contextApp = meAppMap.find(contextId);
+    if (!contextApp)
+        return;
+
+    mecAppInstanceIndex_.erase(contextApp->mecUeAppID, contextApp->appDId, contextId);
+    meAppMap.erase(contextId);
+}
+
+void MecOrchestrator::getConnectedMecHosts()
+{
+    EV << "MecOrchestrator::getConnectedMecHosts - mecHostList: " << par("mecHostList").str() << endl;
+
+    // Retrieve MEC host list from configuration parameter
+    auto mecHostList = check_and_cast<cValueArray *>(par("mecHostList").objectValue());
+
+    if (mecHostList->size() > 0) {
+        for (int i = 0; i < mecHostList->size(); i++) {
+            const char *token = mecHostList->get(i).stringValue();
+            EV << "  → Discovered MEC host path: " << token << endl;
+            cModule *mecHostModule = getSimulation()->getModuleByPath(token);
+            if (!mecHostModule)
+                throw cRuntimeError("MecOrchestrator::getConnectedMecHosts - MEC host %s not found", token);
+            addMecHost(mecHostModule);
+        }
+    } else {
+        EV << "⚠️ MecOrchestrator::getConnectedMecHosts - No mecHostList found in parameters." << endl;
+    }
+
+    // Latency table entries that match no associated MEC host are most likely typos
+    auto hostLatencies = check_and_cast<cValueMap *>(par("hostLatencies").objectValue());
+    for (const auto& entry : hostLatencies->getFields()) {
+        cModule *mecHostModule = getSimulation()->getModuleByPath(entry.first.c_str());
+        if (!mecHostModule || !mecHostRegistry_.contains(mecHostModule->getId()))
+            EV_WARN << "MecOrchestrator::getConnectedMecHosts - hostLatencies entry [" << entry.first
+                    << "] does not match any MEC host in mecHostList" << endl;
+    }
+}
+
+bool MecOrchestrator::addMecHost(cModule *mecHost)
+{
+    Enter_Method("addMecHost");
+
+    if (mecHostRegistry_.contains(mecHost->getId())) {
+        EV << "MecOrchestrator::addMecHost - MEC host " << mecHost->getFullPath() << " already associated" << endl;
+        return false;
+    }
+
+    MecHostDescriptor& hostDesc = mecHostRegistry_.add(createMecHostDescriptor(mecHost));
+    resolveHostLatency(hostDesc);
+    topologyLatency_.addHost();
+    feasibility_.addHost();
+    reservations_.addHost();
+    unplaceableRequests_.clear();
+    spatialIndexStale_ = true;
+    if (telemetrySignal_ != SIMSIGNAL_NULL)
+        mecHost->subscribe(telemetrySignal_, this);
+    hostDesc.txMeter.setWindow(trafficMeterWindow, trafficMeterBuckets);
+    hostDesc.rxMeter.setWindow(trafficMeterWindow, trafficMeterBuckets);
+    subscribeTrafficSignals(hostDesc, true);
+    if (useTopologyLatency && !topologyStale_ && !topologyLatencyDirty_)
+        computeTopologyLatency(hostDesc.index);
+
+    // hosts joining at run time come after the network configuration stage
+    if (initialized())
+        resolveMecHostUpfAddress(hostDesc);
+
+    EV << "MecOrchestrator::addMecHost - MEC host " << mecHost->getFullPath() << " joined, "
+       << mecHostRegistry_.size() << " hosts associated" << endl;
+    return true;
+}
+
+bool MecOrchestrator::removeMecHost(cModule *mecHost)
+{
+    Enter_Method("removeMecHost");
+
+    const MecHostDescriptor *hostDesc = mecHostRegistry_.find(mecHost);
+    if (!hostDesc)
+        return false;
+
+    // deployed MEC apps keep a reference to the host descriptor
+    for (const auto& contextApp : meAppMap) {
+        if (contextApp.hostDescriptor == hostDesc) {
+            EV_WARN << "MecOrchestrator::removeMecHost - MEC host " << mecHost->getFullPath()
+                    << " still runs MEC apps, it cannot leave the MEC system" << endl;
+            return false;
+        }
+    }
+
+    topologyLatency_.removeHost(hostDesc->index);
+    feasibility_.removeHost(hostDesc->index);
+    reservations_.removeHost(hostDesc->index);
+    spatialIndexStale_ = true;
+    if (telemetrySignal_ != SIMSIGNAL_NULL)
+        mecHost->unsubscribe(telemetrySignal_, this);
+    subscribeTrafficSignals(*hostDesc, false);
+    trafficHosts_.erase(mecHost->getId());
+    mecHostRegistry_.remove(mecHost->getId());
+    EV << "MecOrchestrator::removeMecHost - MEC host " << mecHost->getFullPath() << " left, "
+       << mecHostRegistry_.size() << " hosts associated" << endl;
+    return true;
+}
+
+MecHostDescriptor MecOrchestrator::createMecHostDescriptor(cModule *mecHost) const
+{
+    // Resolve all the submodule handles once, failing early on malformed hosts
+    MecHostDescriptor hostDesc;
+    hostDesc.module = mecHost;
+
+    cModule *vimSubmod = mecHost->getSubmodule("vim");
+    if (!vimSubmod)
+        throw cRuntimeError("Submodule 'vim' not found in MEC host: %s", mecHost->getFullPath().c_str());
+    hostDesc.vim = check_and_cast<VirtualisationInfrastructureManager *>(vimSubmod);
+
+    cModule *mecpmSubmod = mecHost->getSubmodule("mecPlatformManager");
+    if (!mecpmSubmod)
+        throw cRuntimeError("Submodule 'mecPlatformManager' not found in MEC host: %s", mecHost->getFullPath().c_str());
+    hostDesc.mecpm = check_and_cast<MecPlatformManager *>(mecpmSubmod);
+
+    cModule *mecPlatform = mecHost->getSubmodule("mecPlatform");
+    cModule *serviceRegistryMod = mecPlatform ? mecPlatform->getSubmodule("serviceRegistry") : nullptr;
+    if (serviceRegistryMod)
+        hostDesc.serviceRegistry = check_and_cast<ServiceRegistry *>(serviceRegistryMod);
+
+    hostDesc.nic = mecHost->getSubmodule("nic");
+    hostDesc.nicQueue = hostDesc.nic ? hostDesc.nic->getSubmodule("queue") : nullptr;
+    hostDesc.upfMec = mecHost->getSubmodule("upf_mec");
+
+    return hostDesc;
+}
+
+void MecOrchestrator::resolveMecHostUpfAddress(MecHostDescriptor& hostDesc) const
+{
+    if (hostDesc.upfMec)
+        hostDesc.upfGtpAddress = inet::L3AddressResolver().resolve(hostDesc.upfMec->getFullPath().c_str());
+}
+
+static double latencyInSeconds(const cValue& value)
+{
+    return value.getUnit() ? value.doubleValueInUnit("s") : value.doubleValue();
+}
+
+void MecOrchestrator::resolveHostLatency(MecHostDescriptor& hostDesc)
+{
+    hostDesc.latencyExpression.reset();
+    hostDesc.latency = par("defaultHostLatency").doubleValue();
+
+    // hosts are looked up by name, as in mecHostList, or by full path
+    auto hostLatencies = check_and_cast<cValueMap *>(par("hostLatencies").objectValue());
+    std::string key = hostDesc.module->getFullName();
+    if (!hostLatencies->containsKey(key.c_str()))
+        key = hostDesc.module->getFullPath();
+    if (!hostLatencies->containsKey(key.c_str())) {
+        EV << "MecOrchestrator::resolveHostLatency - no latency configured for MEC host " << hostDesc.module->getFullPath()
+           << ", using defaultHostLatency (" << hostDesc.latency << "s)" << endl;
+        return;
+    }
+
+    const cValue& value = hostLatencies->get(key.c_str());
+    if (value.getType() == cValue::STRING) {
+        // an expression, e.g. a distribution: re-evaluated at every sample
+        auto expression = std::make_shared<cDynamicExpression>();
+        expression->parse(value.stringValue());
+        hostDesc.latencyExpression = expression;
+        sampleLatency(hostDesc);
+    }
+    else if (value.isNumeric()) {
+        hostDesc.latency = latencyInSeconds(value);
+    }
+    else {
+        throw cRuntimeError("MecOrchestrator::resolveHostLatency - the latency of MEC host %s must be a number or an expression string",
+                            hostDesc.module->getFullPath().c_str());
+    }
+}
+
+double MecOrchestrator::sampleLatency(MecHostDescriptor& hostDesc)
+{
+    if (hostDesc.latencyExpression) {
+        cExpression::Context context(this);
+        hostDesc.latency = latencyInSeconds(hostDesc.latencyExpression->evaluate(&context));
+    }
+    return hostDesc.latency;
+}
+
+//-----------------------------------------------------------------------------
+// Measured RTT
+//-----------------------------------------------------------------------------
+double MecOrchestrator::getHostLatency(int hostIndex)
+{
+    MecHostDescriptor& hostDesc = mecHostRegistry_[hostIndex];
+    if (const RttEstimator *rtt = findRttEstimate(hostDesc))
+        return rtt->getEstimate(rttVarianceWeight);
+    if (useTopologyLatency && topologyLatency_.contains(requestCell_, hostIndex))
+        return topologyLatency_.get(requestCell_, hostIndex);
+    return sampleLatency(hostDesc);
+}
+
+const RttEstimator *MecOrchestrator::findRttEstimate(const MecHostDescriptor& hostDesc) const
+{
+    if (requestCell_ < 0 || requestCell_ >= (int)hostDesc.rttByCell.size())
+        return nullptr;
+    const RttEstimator& rtt = hostDesc.rttByCell[requestCell_];
+    return rtt.isValid() ? &rtt : nullptr;
+}
+
+int MecOrchestrator::findRequestCell(const char *ueIpAddress)
+{
+    // the spatial index registers the cells of the bsLists
+    if (spatialCandidates > 0 && spatialIndexStale_)
+        buildSpatialIndex();
+
+    // nothing measured yet: skip the binder lookups
+    if (cellIndex_.empty() || !ueIpAddress || !*ueIpAddress)
+        return -1;
+
+    MacNodeId ueId = binder_->getMacNodeId(inet::Ipv4Address(ueIpAddress));
+    if (ueId == MacNodeId(0))
+        return -1;
+    auto it = cellIndex_.find(binder_->getNextHop(ueId));
+    return it != cellIndex_.end() ? it->second : -1;
+}
+
+void MecOrchestrator::collectRttSample(MacNodeId cellId, cModule *mecHost, double rtt)
+{
+    Enter_Method_Silent("collectRttSample");
+
+    const MecHostDescriptor *hostDesc = mecHostRegistry_.find(mecHost);
+    if (!hostDesc || cellId == MacNodeId(0)) {
+        ++rttSamplesIgnored_;
+        return;
+    }
+    collectRtt(cellId, mecHostRegistry_[hostDesc->index], rtt);
+}
+
+void MecOrchestrator::receiveSignal(cComponent *source, simsignal_t signalID, const SimTime& rtt, cObject *details)
+{
+    Enter_Method_Silent();
+    if (signalID == telemetrySignal_)
+        handleTelemetrySignal(source);
+    else
+        collectRttProbeSample(source, rtt.dbl());
+}
+
+void MecOrchestrator::receiveSignal(cComponent *source, simsignal_t signalID, double rtt, cObject *details)
+{
+    Enter_Method_Silent();
+    if (signalID == telemetrySignal_)
+        handleTelemetrySignal(source);
+    else
+        collectRttProbeSample(source, rtt);
+}
+
+void MecOrchestrator::collectRttProbeSample(cComponent *source, double rtt)
+{
+    const RttProbeSource& probe = resolveRttProbeSource(source);
+    const MecHostDescriptor *hostDesc = mecHostRegistry_.find(probe.mecHostId);
+    if (!hostDesc || probe.ueId == MacNodeId(0)) {
+        ++rttSamplesIgnored_;
+        return;
+    }
+
+    // the serving cell is looked up at every sample, as the UE may have been handed over
+    MacNodeId cellId = binder_->getNextHop(probe.ueId);
+    if (cellId == MacNodeId(0)) {
+        ++rttSamplesIgnored_;
+        return;
+    }
+    collectRtt(cellId, mecHostRegistry_[hostDesc->index], rtt);
+}
+
+void MecOrchestrator::collectRtt(MacNodeId cellId, MecHostDescriptor& hostDesc, double rtt)
+{
+    int cell = getCellIndex(cellId);
+    if (cell >= (int)hostDesc.rttByCell.size())
+        hostDesc.rttByCell.resize(cell + 1);
+    hostDesc.rttByCell[cell].collect(rtt, simTime().dbl(), rttAlpha, rttBeta);
+    ++rttSamples_;
+    notifyHostChange(hostDesc.index);
+}
+
+int MecOrchestrator::getCellIndex(MacNodeId cellId)
+{
+    auto it = cellIndex_.find(cellId);
+    if (it == cellIndex_.end())
+        it = cellIndex_.emplace(cellId, (int)cellIndex_.size()).first;
+    return it->second;
+}
+
+const MecOrchestrator::RttProbeSource& MecOrchestrator::resolveRttProbeSource(cComponent *source)
+{
+    auto it = rttProbeSources_.find(source->getId());
+    if (it != rttProbeSources_.end())
+        return it->second;
+
+    // A probe is an application of a UE (e.g. an INET PingApp) whose destAddr is a MEC host
+    // or one of its submodules. The result is cached, also for the sources that are not probes.
+    RttProbeSource probe { MacNodeId(0), -1 };
+    cModule *sourceModule = dynamic_cast<cModule *>(source);
+    cModule *ue = sourceModule ? inet::findContainingNode(sourceModule) : nullptr;
+    if (ue && sourceModule->hasPar("destAddr")) {
+        if (ue->hasPar("nrMacNodeId"))
+            probe.ueId = MacNodeId(ue->par("nrMacNodeId").intValue());
+        if (probe.ueId == MacNodeId(0) && ue->hasPar("macNodeId"))
+            probe.ueId = MacNodeId(ue->par("macNodeId").intValue());
+
+        inet::L3AddressResolver resolver;
+        inet::L3Address destAddress;
+        if (resolver.tryResolve(sourceModule->par("destAddr").stringValue(), destAddress)) {
+            for (cModule *module = resolver.findHostWithAddress(destAddress); module; module = module->getParentModule()) {
+                if (mecHostRegistry_.contains(module->getId())) {
+                    probe.mecHostId = module->getId();
+                    break;
+                }
+            }
+        }
+    }
+
+    if (probe.ueId == MacNodeId(0) || probe.mecHostId == -1)
+        EV_WARN << "MecOrchestrator::resolveRttProbeSource - " << source->getFullPath()
+                << " is not a probe between a UE and a MEC host, its RTT samples are ignored" << endl;
+    return rttProbeSources_[source->getId()] = probe;
+}
+
+//-----------------------------------------------------------------------------
+// Topology latency
+//-----------------------------------------------------------------------------
+void MecOrchestrator::extractTopology()
+{
+    topology_.reset(new inet::Topology("topology"));
+    topology_->extractByProperty("networkNode");
+
+    // the cells are the base stations among the network nodes
+    cellNodes_.clear();
+    for (int i = 0; i < topology_->getNumNodes(); i++) {
+        inet::Topology::Node *node = topology_->getNode(i);
+        cModule *module = node->getModule();
+        if (!module->hasPar("nodeType") || !module->hasPar("macNodeId"))
+            continue;
+        const char *nodeType = module->par("nodeType");
+        if (strcmp(nodeType, "GNODEB") && strcmp(nodeType, "ENODEB"))
+            continue;
+        MacNodeId cellId = MacNodeId(module->par("macNodeId").intValue());
+        if (cellId != MacNodeId(0))
+            cellNodes_.push_back({ getCellIndex(cellId), node });
+    }
+    topologyLatency_.setNumCells(cellIndex_.size());
+
+    topologyStale_ = false;
+    topologyLatencyDirty_ = true;
+    EV << "MecOrchestrator::extractTopology - " << topology_->getNumNodes() << " network nodes, "
+       << cellNodes_.size() << " base stations" << endl;
+}
+
+void MecOrchestrator::updateTopologyLatency()
+{
+    if (topologyStale_)
+        extractTopology();
+    if (!topologyLatencyDirty_)
+        return;
+
+    for (int i = 0; i < topology_->getNumNodes(); i++) {
+        inet::Topology::Node *node = topology_->getNode(i);
+        for (int j = 0; j < node->getNumOutLinks(); j++) {
+            inet::Topology::LinkOut *link = node->getLinkOut(j);
+            link->setWeight(getLinkLatency(link->getLocalGate(), link->getRemoteGate(), topologyPacketLength));
+        }
+    }
+    for (int i = 0; i < mecHostRegistry_.size(); i++)
+        computeTopologyLatency(i);
+
+    topologyLatencyDirty_ = false;
+    ++topologyLatencyUpdates_;
+    notifyHostChange(-1);
+}
+
+void MecOrchestrator::computeTopologyLatency(int hostIndex)
+{
+    const MecHostDescriptor& hostDesc = mecHostRegistry_[hostIndex];
+    topologyLatency_.clearHost(hostIndex);
+
+    // the MEC host is either a network node itself or it is reached through its upf_mec
+    inet::Topology::Node *target = topology_->getNodeFor(hostDesc.module);
+    if (!target && hostDesc.upfMec)
+        target = topology_->getNodeFor(hostDesc.upfMec);
+    if (!target) {
+        EV_WARN << "MecOrchestrator::computeTopologyLatency - MEC host " << hostDesc.module->getFullPath()
+                << " is not in the network topology" << endl;
+        return;
+    }
+
+    // a single-target Dijkstra gives the distance from every base station
+    topology_->calculateWeightedSingleShortestPathsTo(target);
+    for (const auto& cell : cellNodes_) {
+        double distance = cell.second->getDistanceToTarget();
+        if (!std::isinf(distance))
+            topologyLatency_.set(cell.first, hostIndex, distance);
+    }
+}
+
+double MecOrchestrator::getLinkLatency(cGate *from, cGate *to, double packetLength)
+{
+    // the connection may cross compound module boundaries, each segment with its own channel
+    double latency = 0;
+    for (cGate *gate = from; gate && gate != to; gate = gate->getNextGate()) {
+        cChannel *channel = gate->getChannel();
+        if (auto datarateChannel = dynamic_cast<cDatarateChannel *>(channel)) {
+            latency += datarateChannel->getDelay().dbl();
+            if (datarateChannel->getDatarate() > 0)
+                latency += packetLength / datarateChannel->getDatarate();
+        }
+        else if (auto delayChannel = dynamic_cast<cDelayChannel *>(channel)) {
+            latency += delayChannel->getDelay().dbl();
+        }
+    }
+    return latency;
+}
+
+void MecOrchestrator::receiveSignal(cComponent *source, simsignal_t signalID, cObject *obj, cObject *details)
+{
+    Enter_Method_Silent();
+    if (signalID == telemetrySignal_) {
+        handleTelemetrySignal(source);
+        return;
+    }
+    if (signalID == queueInSignal_ || signalID == queueOutSignal_ || signalID == queueDropSignal_ || signalID == nicRxSignal_) {
+        handleTrafficSignal(source, signalID, obj);
+        return;
+    }
+    if (signalID != POST_MODEL_CHANGE)
+        return;
+
+    if (auto notification = dynamic_cast<cPostParameterChangeNotification *>(obj)) {
+        // delay or datarate of a link
+        if (dynamic_cast<cChannel *>(notification->par->getOwner()))
+            topologyLatencyDirty_ = true;
+    }
+    else if (dynamic_cast<cPostPathCreateNotification *>(obj) || dynamic_cast<cPostPathCutNotification *>(obj)
+             || dynamic_cast<cPostModuleAddNotification *>(obj) || dynamic_cast<cPostModuleDeleteNotification *>(obj)) {
+        topologyStale_ = true;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// Host telemetry
+//-----------------------------------------------------------------------------
+const MecHostState& MecOrchestrator::getHostState(int hostIndex)
+{
+    MecHostDescriptor& hostDesc = mecHostRegistry_[hostIndex];
+    ++hostStateReads_;
+    if (hostDesc.state.dirty)
+        refreshHostState(hostDesc);
+    return hostDesc.state;
+}
+
+void MecOrchestrator::refreshHostState(MecHostDescriptor& hostDesc)
+{
+    MecHostState& state = hostDesc.state;
+
+    ResourceDescriptor available = hostDesc.vim->getAvailableResources();
+    state.availableRam = available.ram;
+    state.availableDisk = available.disk;
+    state.availableCpu = available.cpu;
+    state.usedCpu = hostDesc.vim->getUsedCpu();
+    state.availableBandwidth = hostDesc.vim->getAvailableBandwidth();
+    state.cpuLoad = hostDesc.vim->getCurrentCpuLoad();
+    state.mecServices = hostDesc.mecpm->getAvailableMecServices();
+
+    // resources promised to placements that are not instantiated yet
+    const HostReservationLedger::Resources& pending = reservations_.getPending(hostDesc.index);
+    if (pending.count > 0 && !ignoreReservations_) {
+        if (state.availableCpu > 0)
+            state.usedCpu = std::min(state.usedCpu + (1 - state.usedCpu) * pending.cpu / state.availableCpu, 1.0);
+        state.availableRam -= pending.ram;
+        state.availableDisk -= pending.disk;
+        state.availableCpu -= pending.cpu;
+    }
+
+    state.dirty = false;
+    feasibility_.setAvailable(hostDesc.index, state.availableRam, state.availableDisk, state.availableCpu);
+    ++telemetryUpdates_;
+}
+
+const HostFeasibilityIndex::HostSet& MecOrchestrator::findCandidateHosts(const ResourceDescriptor& resources)
+{
+    return feasibility_.findHosts(resources.ram, resources.disk, resources.cpu);
+}
+
+//-----------------------------------------------------------------------------
+// Spatial index
+//-----------------------------------------------------------------------------
+void MecOrchestrator::buildSpatialIndex()
+{
+    spatialIndex_.reset(mecHostRegistry_.size());
+    for (int i = 0; i < mecHostRegistry_.size(); i++) {
+        cModule *mecHost = mecHostRegistry_[i].module;
+        if (!mecHost->hasPar("bsList"))
+            continue;
+        auto bsList = check_and_cast<cValueArray *>(mecHost->par("bsList").objectValue());
+        for (int j = 0; j < bsList->size(); j++) {
+            const char *bsName = bsList->get(j).stringValue();
+            cModule *bs = getSimulation()->findModuleByPath(bsName);
+            if (!bs || !bs->hasPar("macNodeId")) {
+                EV_WARN << "MecOrchestrator::buildSpatialIndex - base station " << bsName << " in the bsList of "
+                        << mecHost->getFullPath() << " not found" << endl;
+                continue;
+            }
+            MacNodeId cellId = MacNodeId(bs->par("macNodeId").intValue());
+            if (cellId == MacNodeId(0))
+                continue;
+
+            int cell = getCellIndex(cellId);
+            spatialIndex_.addHostCell(i, cell);
+            if (auto mobility = dynamic_cast<inet::IMobility *>(bs->getSubmodule("mobility"))) {
+                const inet::Coord& position = mobility->getCurrentPosition();
+                spatialIndex_.setCellPosition(cell, position.x, position.y);
+            }
+        }
+    }
+    spatialIndexStale_ = false;
+
+    EV << "MecOrchestrator::buildSpatialIndex - " << spatialIndex_.getNumPlacedHosts() << " of "
+       << mecHostRegistry_.size() << " MEC hosts placed" << endl;
+}
+
+const std::vector<int> *MecOrchestrator::findNearbyHosts(const ResourceDescriptor& resources, const HostFeasibilityIndex::HostSet& candidates)
+{
+    if (spatialCandidates <= 0 || !spatialIndex_.hasCellPosition(requestCell_))
+        return nullptr;
+
+    nearbyHosts_.clear();
+    auto addIfFeasible = [&](int i) {
+        if (candidates.contains(i) && getHostState(i).isAllocable(resources.ram, resources.disk, resources.cpu)
+                && std::find(nearbyHosts_.begin(), nearbyHosts_.end(), i) == nearbyHosts_.end())
+            nearbyHosts_.push_back(i);
+    };
+
+    // the hosts attached to the cell, then the closest ones; the lookup widens until
+    // enough of them can allocate the request
+    for (int i : spatialIndex_.getCellHosts(requestCell_)) {
+        if ((int)nearbyHosts_.size() >= spatialCandidates)
+            break;
+        addIfFeasible(i);
+    }
+    for (int count = spatialCandidates; (int)nearbyHosts_.size() < spatialCandidates; count *= 2) {
+        spatialIndex_.findNearest(requestCell_, count, nearestHosts_);
+        for (int k = 0; k < (int)nearestHosts_.size() && (int)nearbyHosts_.size() < spatialCandidates; k++)
+            addIfFeasible(nearestHosts_[k]);
+        if ((int)nearestHosts_.size() < count)
+            break;  // every placed host was looked at
+    }
+    for (int i : spatialIndex_.getUnplacedHosts())
+        addIfFeasible(i);
+
+    ++spatialDecisions_;
+    spatialScoredHosts_ += nearbyHosts_.size();
+    return &nearbyHosts_;
+}
+
+bool MecOrchestrator::isUnplaceable(const ResourceDescriptor& resources)
+{
+    const HostFeasibilityIndex::HostSet& candidates = findCandidateHosts(resources);
+    for (int i = candidates.next(0); i >= 0; i = candidates.next(i + 1)) {
+        if (getHostState(i).isAllocable(resources.ram, resources.disk, resources.cpu))
+            return false;
+    }
+    return true;
+}
+
+void MecOrchestrator::markHostStateDirty(const MecHostDescriptor& hostDesc)
+{
+    ++telemetryNotifications_;
+    invalidateHostState(hostDesc.index);
+}
+
+void MecOrchestrator::invalidateHostState(int hostIndex)
+{
+    mecHostRegistry_[hostIndex].state.dirty = true;
+    feasibility_.setUnknown(hostIndex);
+    notifyHostChange(hostIndex);
+}
+
+void MecOrchestrator::notifyHostChange(int hostIndex)
+{
+    if (mecHostSelectionPolicy_)
+        mecHostSelectionPolicy_->handleHostChange(hostIndex);
+}
+
+void MecOrchestrator::handleTelemetrySignal(cComponent *source)
+{
+    // the signal propagates up from a submodule of the MEC host (e.g. its VIM)
+    if (const MecHostDescriptor *hostDesc = findMecHostOf(source)) {
+        markHostStateDirty(*hostDesc);
+        unplaceableRequests_.clear();  // the change may be a release
+    }
+}
+
+MecHostDescriptor *MecOrchestrator::findMecHostOf(cComponent *source)
+{
+    cModule *module = dynamic_cast<cModule *>(source);
+    if (!module)
+        module = source->getParentModule();
+    for ( ; module; module = module->getParentModule()) {
+        if (const MecHostDescriptor *hostDesc = mecHostRegistry_.find(module))
+            return &mecHostRegistry_[hostDesc->index];
+    }
+    return nullptr;
+}
+
+//-----------------------------------------------------------------------------
+// NIC traffic meters
+//-----------------------------------------------------------------------------
+double MecOrchestrator::getHostThroughput(int hostIndex)
+{
+    MecHostDescriptor& hostDesc = mecHostRegistry_[hostIndex];
+    double now = simTime().dbl();
+    return hostDesc.txMeter.getRate(now) + hostDesc.rxMeter.getRate(now);
+}
+
+double MecOrchestrator::getHostQueueLength(int hostIndex)
+{
+    return mecHostRegistry_[hostIndex].queueGauge.getBitLength();
+}
+
+void MecOrchestrator::subscribeTrafficSignals(const MecHostDescriptor& hostDesc, bool subscribe)
+{
+    auto update = [this, subscribe](cModule *module, simsignal_t signal) {
+        if (!module || signal == SIMSIGNAL_NULL)
+            return;
+        if (subscribe)
+            module->subscribe(signal, this);
+        else
+            module->unsubscribe(signal, this);
+    };
+    update(hostDesc.nicQueue, queueInSignal_);
+    update(hostDesc.nicQueue, queueOutSignal_);
+    update(hostDesc.nicQueue, queueDropSignal_);
+    update(hostDesc.nic, nicRxSignal_);
+}
+
+void MecOrchestrator::handleTrafficSignal(cComponent *source, simsignal_t signalID, cObject *obj)
+{
+    cPacket *packet = dynamic_cast<cPacket *>(obj);
+    MecHostDescriptor *hostDesc = packet ? findMecHostOf(source) : nullptr;
+    if (!hostDesc)
+        return;
+
+    double bits = packet->getBitLength();
+    if (signalID == nicRxSignal_) {
+        hostDesc->rxMeter.collect(bits, simTime().dbl());
+        trafficHosts_.insert(hostDesc->module->getId());
+    }
+    else if (signalID == queueInSignal_) {
+        hostDesc->queueGauge.push(bits);
+    }
+    else {
+        // dequeued for transmission, or dropped
+        hostDesc->queueGauge.pop(bits);
+        if (signalID == queueOutSignal_) {
+            hostDesc->txMeter.collect(bits, simTime().dbl());
+            trafficHosts_.insert(hostDesc->module->getId());
+        }
+    }
+    notifyHostChange(hostDesc->index);
+}
+
+void MecOrchestrator::expireTrafficMeters()
+{
+    // the meters retire a bucket every trafficMeterWindow / trafficMeterBuckets
+    double now = simTime().dbl();
+    long bucket = (long)std::floor(now / (trafficMeterWindow / trafficMeterBuckets));
+    if (bucket == trafficMeterBucket_)
+        return;
+    trafficMeterBucket_ = bucket;
+
+    for (auto it = trafficHosts_.begin(); it != trafficHosts_.end(); ) {
+        const MecHostDescriptor *hostDesc = mecHostRegistry_.find(*it);
+        if (!hostDesc) {
+            it = trafficHosts_.erase(it);
+            continue;
+        }
+        notifyHostChange(hostDesc->index);
+
+        // a host without traffic in the whole window keeps a zero rate until its next packet
+        MecHostDescriptor& host = mecHostRegistry_[hostDesc->index];
+        if (host.txMeter.getRate(now) == 0 && host.rxMeter.getRate(now) == 0)
+            it = trafficHosts_.erase(it);
+        else
+            ++it;
+    }
+}
+
+void MecOrchestrator::receiveSignal(cComponent *source, simsignal_t signalID, intval_t value, cObject *details)
+{
+    Enter_Method_Silent();
+    if (signalID == telemetrySignal_)
+        handleTelemetrySignal(source);
+}
+
+const ApplicationDescriptor& MecOrchestrator::onboardApplicationPackage(const char *fileName)
+{
+    STAGE_TIMER(stageProfile_, ONBOARD);
+    EV << "MecOrchestrator::onboardApplicationPackage - onboarding application descriptor from: " << fileName << endl;
+
+    ApplicationDescriptor appDesc(fileName);
+    std::string appDId = appDesc.getAppDId();
+
+    if (mecApplicationDescriptors_.find(appDId) != mecApplicationDescriptors_.end()) {
+        EV << "  → ApplicationDescriptor [" << appDId << "] already onboarded. Skipping.\n";
+    } else {
+        mecApplicationDescriptors_[appDId] = appDesc;
+    }
+
+    return mecApplicationDescriptors_[appDId];
+}
+
+void MecOrchestrator::registerMecService(ServiceDescriptor& serviceDescriptor) const
+{
+    EV << "MecOrchestrator::registerMecService - Registering service: [" << serviceDescriptor.name << "]" << endl;
+
+    for (int i = 0; i < mecHostRegistry_.size(); i++) {
+        const MecHostDescriptor& hostDesc = mecHostRegistry_[i];
+        cModule *mecHost = hostDesc.module;
+        ServiceRegistry *serviceRegistry = hostDesc.serviceRegistry;
+
+        if (serviceRegistry != nullptr) {
+            serviceRegistry->registerMecService(serviceDescriptor);
+
+            EV << "  → Registered on MEC host [" << mecHost->getName() << "]" << endl;
+        } else {
+            EV << "  ⚠️ Warning: serviceRegistry submodule missing in host: " << mecHost->getName() << endl;
+        }
+    }
+}
+
+void MecOrchestrator::onboardApplicationPackages()
+{
+    // Retrieve application package list from parameters
+    auto mecApplicationPackageList = check_and_cast<cValueArray *>(par("mecApplicationPackageList").objectValue());
+
+    if (mecApplicationPackageList->size() > 0) {
+        for (int i = 0; i < mecApplicationPackageList->size(); i++) {
+            const char *token = mecApplicationPackageList->get(i).stringValue();
+            std::string fullPath = std::string("ApplicationDescriptors/") + token + ".json";
+
+            EV << "MecOrchestrator::onboardApplicationPackages - Loading descriptor: " << fullPath << endl;
+            onboardApplicationPackage(fullPath.c_str());
+        }
+    } else {
+        EV << "⚠️ MecOrchestrator::onboardApplicationPackages - No packages defined in mecApplicationPackageList." << endl;
+    }
+}
+
+const ApplicationDescriptor* MecOrchestrator::getApplicationDescriptorByAppName(const std::string& appName) const
+{
+    // Iterate through onboarded descriptors and match by application name
+    for (const auto& appDesc : mecApplicationDescriptors_) {
+        if (appDesc.second.getAppName() == appName)
+            return &(appDesc.second);
+    }
+
+    // No match found
+    return nullptr;
+}
+
+simtime_t MecOrchestrator::computeLatencyForHost(cModule* mecHost)
+{
+    // The value the selection policy scored: the measured RTT from the cell of the request,
+    // if any, else the topology latency from that cell, else the last sample of the configured latency
+    const MecHostDescriptor *hostDesc = mecHostRegistry_.find(mecHost);
+    if (!hostDesc)
+        throw cRuntimeError("MecOrchestrator::computeLatencyForHost - MEC host %s is not connected to the orchestrator", mecHost->getFullPath().c_str());
+    if (const RttEstimator *rtt = findRttEstimate(*hostDesc))
+        return rtt->getEstimate(rttVarianceWeight);
+    if (useTopologyLatency && topologyLatency_.contains(requestCell_, hostDesc->index))
+        return topologyLatency_.get(requestCell_, hostDesc->index);
+    return hostDesc->latency;
+}
+
+
+
+} //namespace
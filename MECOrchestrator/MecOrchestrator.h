@@ -0,0 +1,492 @@
+//
+//                  Simu5G
+//
+// Authors: Giovanni Nardini, Giovanni Stea, Antonio Virdis (University of Pisa)
+//
+// This file is part of a software released under the license included in file
+// "license.pdf". Please read LICENSE and README files before using it.
+// The above files and the present reference are part of the software itself,
+// and cannot be removed from it.
+//
+
+#ifndef __MECORCHESTRATORMANAGER_H_
+#define __MECORCHESTRATORMANAGER_H_
+
+#include <unordered_map>
+#include <unordered_set>
+
+#include <inet/common/ModuleRefByPar.h>
+#include <inet/common/Topology.h>
+#include <inet/networklayer/common/L3Address.h>
+#include <inet/networklayer/common/L3AddressResolver.h>
+#include <inet/transportlayer/contract/udp/UdpSocket.h>
+
+//BINDER and UTILITIES
+#include "common/LteCommon.h"
+#include "common/binder/Binder.h"           //to handle cars dynamically leaving the Network
+#include "nodes/mec/MECOrchestrator/ApplicationDescriptor/ApplicationDescriptor.h"
+#include "nodes/mec/MECOrchestrator/CellLatencyMatrix.h"
+#include "nodes/mec/MECOrchestrator/HostFeasibilityIndex.h"
+#include "nodes/mec/MECOrchestrator/HostReservationLedger.h"
+#include "nodes/mec/MECOrchestrator/HostSpatialIndex.h"
+#include "nodes/mec/MECOrchestrator/MecAppInstanceIndex.h"
+#include "nodes/mec/MECOrchestrator/MecHostRegistry.h"
+#include "nodes/mec/MECOrchestrator/QuantileSketch.h"
+#include "nodes/mec/MECOrchestrator/RttEstimator.h"
+#include "nodes/mec/MECOrchestrator/SlotMap.h"
+#include "nodes/mec/MECOrchestrator/StageProfile.h"
+#include "nodes/mec/MECOrchestrator/UnplaceableRequestCache.h"
+#include "nodes/mec/MECPlatform/MEAppPacket_m.h"
+#include "nodes/mec/MECPlatform/MEAppPacket_Types.h"
+#include "nodes/mec/utils/MecCommon.h"
+
+namespace simu5g {
+
+using namespace omnetpp;
+
+struct mecAppMapEntry
+{
+    int contextId;
+    std::string appDId;
+    std::string mecAppName;
+    std::string mecAppInstanceId;
+    int mecUeAppID;         //ID
+    cModule *mecHost = nullptr; // reference to the mecHost where the mec app has been deployed
+    cModule *vim = nullptr;       // for VirtualisationInfrastructureManager methods
+    cModule *mecpm = nullptr;     // for mecPlatformManager methods
+    cModule* reference = nullptr; // direct reference to mec app instance (omnet module)
+    const MecHostDescriptor *hostDescriptor = nullptr; // cached handles of mecHost
+
+    std::string ueSymbolicAddress;
+    inet::L3Address ueAddress;  //for downstream using UDP Socket
+    int uePort;
+    inet::L3Address mecAppAddress;  //for downstream using UDP Socket
+    int mecAppPort;
+
+    bool isEmulated;
+
+    int lastAckStartSeqNum;
+    int lastAckStopSeqNum;
+
+};
+
+class UALCMPMessage;
+class MECOrchestratorMessage;
+class SelectionPolicyBase;
+
+//
+// This module implements the MEC orchestrator of a MEC system.
+// It does not follow ETSI compliant APIs, but it handles the lifecycle operations
+// of the standard by using OMNeT++ features.
+// Communications with the LCM proxy occur via connections, while the MEC hosts associated with
+// the MEC system (and the MEC orchestrator) are managed with the mecHostList parameter.
+// This MEC orchestrator provides:
+//   - MEC app instantiation
+//   - MEC app termination
+//   - MEC app run-time onboarding
+//
+// The latency of the MEC hosts is configured (hostLatencies), computed from the links
+// between the base stations and the MEC hosts (useTopologyLatency) or measured: the
+// orchestrator listens to the RTT samples of probes running on the UEs (rttSignal) and
+// keeps a smoothed estimate per (cell, MEC host) path.
+//
+
+class MecOrchestrator : public cSimpleModule, public cListener
+{
+    // Selection Policies modules access grants
+    friend class SelectionPolicyBase;
+    friend class MecServiceSelectionBased;
+    friend class AvailableResourcesSelectionBased;
+    friend class MecHostSelectionBased;
+
+    SelectionPolicyBase *mecHostSelectionPolicy_ = nullptr;
+
+    //------------------------------------
+    //Binder module
+    inet::ModuleRefByPar<Binder> binder_;
+    //------------------------------------
+
+    //parent modules
+
+    // MEC hosts associated with the MEC system, shared by reference with the selection policies
+    MecHostRegistry mecHostRegistry_;
+    const std::vector<cModule *>& mecHosts = mecHostRegistry_.getModules();
+
+    //storing the UEApp and MEApp information
+    //key = contextId (generation-tagged, allocated by the slot map) - value mecAppMapEntry
+    SlotMap<mecAppMapEntry> meAppMap;
+    MecAppInstanceIndex mecAppInstanceIndex_;  // (ueAppID, appDId) -> contextId of the entries in meAppMap
+    std::map<std::string, ApplicationDescriptor> mecApplicationDescriptors_;
+    std::unordered_map<unsigned int, simtime_t> contextStartTimes;        // key = request id, consumed by the first ack
+
+    double onboardingTime;
+    double instantiationTime;
+    double terminationTime;
+
+    // Instantiation hooks of the latencyAwareScenario traits (see LatencyAwareScenario.h)
+    double scenarioFailureProbability_ = 0.0;   // probability of a forced instantiation failure
+    simtime_t scenarioExtraDelay_;              // added to every instantiation, failed or not
+    long scenarioForcedFailures_ = 0;
+
+    // Batched admission (admissionBatchWindow): the requests of a window wait in
+    // pendingAdmissions_ and are placed together when the timer fires
+    struct AdmissionRequest
+    {
+        unsigned int requestId;
+        const ApplicationDescriptor *desc;
+        ResourceDescriptor resources;
+        int cell;                           // cell serving the UE (-1 = unknown)
+    };
+    struct AdmissionPlacement
+    {
+        cModule *host = nullptr;            // nullptr = no host
+        const ApplicationDescriptor *desc = nullptr;  // resolved (and onboarded) by flushAdmissionBatch()
+    };
+    double admissionBatchWindow = 0;
+    cMessage *admissionBatchTimer_ = nullptr;
+    std::vector<UALCMPMessage *> pendingAdmissions_;                // owned copies of the requests
+    std::unordered_map<unsigned int, AdmissionPlacement> admissionPlan_;   // key = request id
+
+  public:
+    ~MecOrchestrator() override;
+
+    const ApplicationDescriptor *getApplicationDescriptorByAppName(const std::string& appName) const;
+    const std::map<std::string, ApplicationDescriptor> *getApplicationDescriptors() const { return &mecApplicationDescriptors_; }
+    const MecHostRegistry& getMecHostRegistry() const { return mecHostRegistry_; }
+
+    /*
+     * These methods let a MEC host join or leave the MEC system at run time.
+     * A host cannot leave while MEC apps are still deployed on it.
+     *
+     * @return false if the host is already associated (add) or cannot be removed (remove)
+     */
+    bool addMecHost(cModule *mecHost);
+    bool removeMecHost(cModule *mecHost);
+
+    /*
+     * Samples the latency of the MEC host at the given registry index, as configured by the
+     * hostLatencies parameter: constant entries are a plain read, expression entries
+     * (e.g. distributions) are re-evaluated.
+     *
+     * @return the latency in seconds
+     */
+    double sampleHostLatency(int hostIndex) { return sampleLatency(mecHostRegistry_[hostIndex]); }
+
+    /*
+     * Latency of the MEC host at the given registry index as seen from the cell serving the UE
+     * of the request being processed: the measured RTT estimate of the (cell, host) path if
+     * there is one, else the topology latency of the path (if enabled), else the hostLatencies
+     * entry (see sampleHostLatency()). O(1).
+     *
+     * @return the latency in seconds
+     */
+    double getHostLatency(int hostIndex);
+
+    // dense index of the cell serving the UE of the request being processed (-1 = unknown)
+    int getRequestCell() const { return requestCell_; }
+
+    /*
+     * Resource state of the MEC host at the given registry index. It is read from the VIM and
+     * the MEC platform manager only if a change was published for the host since the last
+     * read (telemetrySignal, or an app instantiated or terminated by the orchestrator);
+     * otherwise it is a plain O(1) read.
+     */
+    const MecHostState& getHostState(int hostIndex);
+
+    /*
+     * MEC hosts that may allocate the given resources, as a set of registry indices, from
+     * availability bitsets kept up to date with the host states (see HostFeasibilityIndex).
+     * The set is exact for the hosts whose state is current; a host with a pending change
+     * stays in it until its state is read, so the candidates must still pass
+     * getHostState(i).isAllocable(). O(M / 64). The set is reused by the next call.
+     */
+    const HostFeasibilityIndex::HostSet& findCandidateHosts(const ResourceDescriptor& resources);
+
+    /*
+     * With spatialCandidates > 0, the registry indices of the spatialCandidates hosts closest to
+     * the cell of the current request that can allocate the resources (see HostSpatialIndex),
+     * plus the hosts with no position; nullptr if every host is to be considered (no pruning,
+     * or the cell of the request is unknown). The list is reused by the next call.
+     *
+     * @param candidates the result of findCandidateHosts() for the same resources
+     */
+    const std::vector<int> *findNearbyHosts(const ResourceDescriptor& resources, const HostFeasibilityIndex::HostSet& candidates);
+
+    /*
+     * Live NIC metrics of the MEC host at the given registry index, measured from the packet
+     * signals of its NIC and NIC queue: tx + rx throughput over the last trafficMeterWindow
+     * (bit/s) and the current queue occupancy (bits). Amortized O(1).
+     */
+    double getHostThroughput(int hostIndex);
+    double getHostQueueLength(int hostIndex);
+
+    /*
+     * Adds an RTT sample (in seconds) of the path between a cell, identified by the MacNodeId
+     * of its base station, and a MEC host. The probes emitting rttSignal are fed automatically;
+     * other modules (e.g. MEC apps timestamping their traffic) can report samples directly.
+     */
+    void collectRttSample(MacNodeId cellId, cModule *mecHost, double rtt);
+
+    /*
+     * This method registers the MEC service on all the Service Registry of the MEC host associated
+     * with the MEC system
+     *
+     * @param ServiceDescriptor descriptor of the MEC service to register
+     */
+    void registerMecService(ServiceDescriptor&) const;
+    simtime_t bestLatency = SIMTIME_ZERO;
+
+  protected:
+
+    int numInitStages() const override { return inet::NUM_INIT_STAGES; }
+    void initialize(int stage) override;
+    void handleMessage(cMessage *msg) override;
+    void handleParameterChange(const char *parname) override;
+    void finish() override;
+
+    // RTT samples of the probes (rttSignal), as simtime_t or as double
+    void receiveSignal(cComponent *source, simsignal_t signalID, const SimTime& rtt, cObject *details) override;
+    void receiveSignal(cComponent *source, simsignal_t signalID, double rtt, cObject *details) override;
+    // resource changes published by the MEC hosts (telemetrySignal), with any value type
+    void receiveSignal(cComponent *source, simsignal_t signalID, intval_t value, cObject *details) override;
+    // model changes (links), for the topology latency, and object-valued telemetry
+    void receiveSignal(cComponent *source, simsignal_t signalID, cObject *obj, cObject *details) override;
+
+    void handleUALCMPMessage(cMessage *msg);
+
+    // handling CREATE_CONTEXT_APP type
+    // it selects the most suitable MEC host and calls the method of its MEC platform manager to require
+    // the MEC app instantiation
+    void startMECApp(UALCMPMessage *msg);
+
+    /*
+     * Batched admission: the requests of the current window are placed by running the selection
+     * policy for each of them, largest resource demand first (first-fit decreasing), with the
+     * resources given to the previous requests of the batch reserved on their hosts. The
+     * placements are then carried out by startMECApp() in arrival order.
+     */
+    void enqueueAdmission(UALCMPMessage *msg);
+    void flushAdmissionBatch();
+
+    /*
+     * Runs the selection policy for the requests in the given order, reserving the resources
+     * of each placement; the reservations are rolled back afterwards.
+     *
+     * @param plan if not null, receives the placement of every request; if null, the placement
+     *        is only evaluated and the policy is called directly (no reservation counterfactual)
+     * @return number of requests placed; latencySum receives the sum of their host latencies
+     */
+    int placeAdmissionBatch(const std::vector<AdmissionRequest>& requests, const std::vector<int>& order,
+                            std::unordered_map<unsigned int, AdmissionPlacement> *plan, double& latencySum);
+
+    /*
+     * Two-phase placement: the resources of a request are reserved on the selected host
+     * until its instantiation succeeds (commit: the VIM accounts for them) or fails
+     * (rollback). The host states seen by the selection policies are the VIM values minus
+     * the pending reservations (see refreshHostState()).
+     */
+    void reserveHostResources(unsigned int requestId, int hostIndex, const ResourceDescriptor& resources);
+    void commitHostReservation(unsigned int requestId);
+    void rollbackHostReservation(unsigned int requestId);
+
+    // runs the selection policy; counts the decisions changed by the pending reservations
+    cModule *selectMecHost(const ApplicationDescriptor& desc);
+
+    // handling DELETE_CONTEXT_APP type
+    // it calls the method of the MEC platform manager of the MEC host where the MEC app has been deployed
+    // to delete the MEC app
+    void stopMECApp(UALCMPMessage *msg);
+
+    // sending ACK_CREATE_CONTEXT_APP or ACK_DELETE_CONTEXT_APP
+    void sendCreateAppContextAck(bool result, unsigned int requestSno, int contextId = -1);
+    void sendDeleteAppContextAck(bool result, unsigned int requestSno, int contextId = -1);
+
+    /*
+     * These methods add and remove MEC app contexts, keeping meAppMap and the
+     * (ueAppID, appDId) instance index consistent.
+     *
+     * @return the context id allocated for the new entry
+     */
+    int addMecAppContext(const mecAppMapEntry& entry);
+    void removeMecAppContext(int contextId);
+
+    /*
+     * MEC hosts associated with the MEC system are configured through the mecHostList NED parameter.
+     * This method gets the references to them.
+     */
+    void getConnectedMecHosts();
+
+    /*
+     * Resolves the submodule handles of a MEC host into a MecHostDescriptor.
+     */
+    MecHostDescriptor createMecHostDescriptor(cModule *mecHost) const;
+
+    /*
+     * Resolves the GTP address of the upf_mec of the given MEC host.
+     * It must run after the network configuration stage.
+     */
+    void resolveMecHostUpfAddress(MecHostDescriptor& hostDesc) const;
+
+    /*
+     * Resolves the hostLatencies entry of a MEC host (or defaultHostLatency) into its descriptor.
+     */
+    void resolveHostLatency(MecHostDescriptor& hostDesc);
+    double sampleLatency(MecHostDescriptor& hostDesc);
+
+    /*
+     * Measured RTT per (cell, MEC host). Cells get a dense index on their first sample; the
+     * estimators live in MecHostDescriptor::rttByCell, so they follow the host in the registry.
+     */
+    struct RttProbeSource
+    {
+        MacNodeId ueId;         // UE running the probe (0 if the source is not on a UE)
+        int mecHostId;          // module id of the probed MEC host (-1 if it is not a MEC host)
+    };
+    std::unordered_map<int, RttProbeSource> rttProbeSources_;   // key = id of the emitting module
+    std::unordered_map<MacNodeId, int> cellIndex_;             // base station id -> dense cell index
+    int requestCell_ = -1;                                      // cell serving the UE of the current request (-1 = unknown)
+    double rttAlpha = 0.125;
+    double rttBeta = 0.25;
+    double rttVarianceWeight = 0.0;
+    long rttSamples_ = 0;
+    long rttSamplesIgnored_ = 0;
+
+    const RttProbeSource& resolveRttProbeSource(cComponent *source);
+    void collectRttProbeSample(cComponent *source, double rtt);
+    void collectRtt(MacNodeId cellId, MecHostDescriptor& hostDesc, double rtt);
+    int findRequestCell(const char *ueIpAddress);
+    const RttEstimator *findRttEstimate(const MecHostDescriptor& hostDesc) const;
+    int getCellIndex(MacNodeId cellId);
+
+    /*
+     * Transport latency from each cell to each MEC host (useTopologyLatency): the shortest path
+     * from the base station to the host, weighting each link with its delay plus the transmission
+     * time of topologyPacketLength bits. The topology is extracted once; a host joining computes
+     * its own row, while changes to the links mark the matrix dirty and it is recomputed before
+     * the next selection.
+     */
+    bool useTopologyLatency = false;
+    double topologyPacketLength = 0;
+    CellLatencyMatrix topologyLatency_;                          // rows index-aligned with mecHostRegistry_
+    std::unique_ptr<inet::Topology> topology_;
+    std::vector<std::pair<int, inet::Topology::Node *>> cellNodes_;  // (cell index, base station node)
+    bool topologyStale_ = true;                                  // the topology must be (re-)extracted
+    bool topologyLatencyDirty_ = true;                           // the link weights changed
+    long topologyLatencyUpdates_ = 0;
+
+    /*
+     * Push-based host telemetry: the orchestrator subscribes to telemetrySignal on every MEC
+     * host, and a notification from the host subtree (e.g. its VIM) marks its state dirty.
+     */
+    simsignal_t telemetrySignal_ = -1;
+    long telemetryNotifications_ = 0;      // changes published (signals and app lifecycle)
+    long telemetryUpdates_ = 0;            // refreshes of a host state from the modules
+    long hostStateReads_ = 0;
+
+    HostFeasibilityIndex feasibility_;     // availability classes, index-aligned with mecHostRegistry_
+
+    HostReservationLedger reservations_;   // placements not accounted for by the VIMs yet
+    bool ignoreReservations_ = false;      // host states without the reservations, see selectMecHost()
+    long reservationCommits_ = 0;
+    long reservationRollbacks_ = 0;
+    long reservedDecisions_ = 0;           // decisions taken while reservations were pending
+    long reservationChangedDecisions_ = 0; // ... that selected another host than without them
+
+    // resource tuples that no host can allocate, cleared when resources are released or a host joins
+    UnplaceableRequestCache unplaceableRequests_;
+    long unplaceableFastFails_ = 0;
+
+    // Hosts by position of the gNBs of their bsList, built on the first request after a join or leave
+    int spatialCandidates = 0;
+    HostSpatialIndex spatialIndex_;
+    bool spatialIndexStale_ = true;
+    std::vector<int> nearbyHosts_;         // result of findNearbyHosts()
+    std::vector<int> nearestHosts_;        // k-d tree lookups
+    long spatialDecisions_ = 0;
+    long spatialScoredHosts_ = 0;
+
+    void buildSpatialIndex();
+
+    // whether no MEC host can allocate the resources (exact, reads the candidate host states)
+    bool isUnplaceable(const ResourceDescriptor& resources);
+
+    void refreshHostState(MecHostDescriptor& hostDesc);
+    void markHostStateDirty(const MecHostDescriptor& hostDesc);
+    void invalidateHostState(int hostIndex);   // read again on the next access, not a published change
+
+    // tells the selection policy that the metrics of a host changed (-1 = all hosts)
+    void notifyHostChange(int hostIndex);
+    void handleTelemetrySignal(cComponent *source);
+
+    // NIC traffic meters of the MEC hosts (see getHostThroughput() and getHostQueueLength())
+    simsignal_t queueInSignal_ = SIMSIGNAL_NULL;
+    simsignal_t queueOutSignal_ = SIMSIGNAL_NULL;
+    simsignal_t queueDropSignal_ = SIMSIGNAL_NULL;
+    simsignal_t nicRxSignal_ = SIMSIGNAL_NULL;
+    double trafficMeterWindow = 1.0;
+    int trafficMeterBuckets = 10;
+    std::unordered_set<int> trafficHosts_;     // module ids of the hosts with traffic in the meter window
+    long trafficMeterBucket_ = -1;              // meter bucket of the last expireTrafficMeters()
+
+    void subscribeTrafficSignals(const MecHostDescriptor& hostDesc, bool subscribe);
+    void handleTrafficSignal(cComponent *source, simsignal_t signalID, cObject *obj);
+    // the rates also change when the window slides, without packets: notifies those hosts
+    void expireTrafficMeters();
+
+    // the MEC host the given component belongs to (nullptr if none)
+    MecHostDescriptor *findMecHostOf(cComponent *source);
+
+    void extractTopology();
+    void updateTopologyLatency();
+    void computeTopologyLatency(int hostIndex);
+    static double getLinkLatency(cGate *from, cGate *to, double packetLength);
+
+    /*
+     * The list of the MEC app descriptor to be onboarded at initialization time is
+     * configured through the mecApplicationPackageList NED parameter.
+     * This method loads the app descriptors in the mecApplicationDescriptors_ map
+     *
+     */
+    void onboardApplicationPackages();
+
+    /*
+     * This method loads the app descriptors at runtime.
+     *
+     * @param ApplicationDescriptor with the computation and MEC services requirements
+     *
+     * @return ApplicationDescriptor structure of the MEC app descriptor
+     */
+    const ApplicationDescriptor& onboardApplicationPackage(const char *fileName);
+
+    simsignal_t taskDelaySignal;
+    simsignal_t selectedLatencySignal;
+    simsignal_t packetLossSignal;
+    simtime_t lastDelay = SIMTIME_ZERO;
+
+    // Streaming percentiles of the latency statistics, recorded as scalars in finish()
+    // so that tail latencies are available with vector recording disabled
+    bool recordStatistics = true;
+    bool recordCounterfactuals_ = false;   // recordStatistics and recordCounterfactuals
+    QuantileSketch taskDelaySketch_;
+    QuantileSketch selectedLatencySketch_;
+    QuantileSketch admissionSolveWallClockSketch_;   // host cost of placing an admission batch, in seconds
+
+    simsignal_t admissionBatchSizeSignal;
+    simsignal_t admissionBatchGainSignal;
+    simsignal_t admissionBatchLatencyGainSignal;
+    long admissionBatches_ = 0;
+    long admissionBatchedRequests_ = 0;
+    long admissionBatchGain_ = 0;
+    void recordQuantiles(const char *name, const QuantileSketch& sketch, const char *unit);
+
+#if SIMU5G_STAGE_TIMING
+    StageProfile stageProfile_;                  // wall-clock cost of each request stage
+#endif
+    simtime_t computeLatencyForHost(cModule* mecHost);
+
+};
+
+} //namespace
+
+#endif
+
@@ -0,0 +1,130 @@
+#ifndef __SIMU5G_QUANTILESKETCH_H_
+#define __SIMU5G_QUANTILESKETCH_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace simu5g {
+
+/**
+ * QuantileSketch
+ *
+ * Streaming quantile estimator with bounded relative error, in the style of an HDR
+ * histogram. Positive values are counted in log-linear buckets: every power-of-two
+ * range [2^e, 2^(e+1)) is split into 2^precisionBits equal sub-buckets, so any
+ * quantile is reported within a relative error of 2^-(precisionBits+1) (about 0.4%
+ * with the default 7 bits). Zero and negative values share a single bucket.
+ *
+ * Recording is O(1) and the memory is fixed at construction: with the default range
+ * (1 ns to ~4.6 hours) and precision the bucket array takes ~45 KiB, whatever the
+ * number of samples. Values outside the range are clamped to it; min and max are
+ * exact.
+ *
+ * The class does not depend on OMNeT++.
+ */
+class QuantileSketch
+{
+  public:
+    QuantileSketch(double lowestValue = 1e-9, double highestValue = 16384.0, int precisionBits = 7)
+        : subBuckets_(1 << precisionBits)
+    {
+        std::frexp(lowestValue, &minExponent_);
+        std::frexp(highestValue, &maxExponent_);
+        counts_.assign(static_cast<std::size_t>(maxExponent_ - minExponent_ + 1) * subBuckets_, 0);
+    }
+
+    void collect(double value)
+    {
+        ++count_;
+        sum_ += value;
+        min_ = std::min(min_, value);
+        max_ = std::max(max_, value);
+
+        if (!(value > 0)) {
+            ++nonPositive_;
+            return;
+        }
+        ++counts_[bucketOf(value)];
+    }
+
+    /*
+     * @param q quantile in [0, 1]
+     * @return the estimated q-quantile, or NaN if nothing has been collected
+     */
+    double getQuantile(double q) const
+    {
+        if (count_ == 0)
+            return std::numeric_limits<double>::quiet_NaN();
+
+        // rank of the sample that holds the quantile (1-based, nearest-rank definition)
+        uint64_t rank = static_cast<uint64_t>(std::ceil(std::clamp(q, 0.0, 1.0) * count_));
+        rank = std::max<uint64_t>(rank, 1);
+
+        if (rank <= nonPositive_)
+            return min_ <= 0 ? min_ : 0.0;
+
+        uint64_t seen = nonPositive_;
+        for (std::size_t i = 0; i < counts_.size(); ++i) {
+            seen += counts_[i];
+            if (seen >= rank)
+                return std::clamp(bucketMidpoint(i), min_, max_);
+        }
+        return max_;
+    }
+
+    uint64_t getCount() const { return count_; }
+    double getSum() const { return sum_; }
+    double getMean() const { return count_ ? sum_ / count_ : std::numeric_limits<double>::quiet_NaN(); }
+    double getMin() const { return count_ ? min_ : std::numeric_limits<double>::quiet_NaN(); }
+    double getMax() const { return count_ ? max_ : std::numeric_limits<double>::quiet_NaN(); }
+
+    void clear()
+    {
+        std::fill(counts_.begin(), counts_.end(), 0);
+        count_ = nonPositive_ = 0;
+        sum_ = 0;
+        min_ = std::numeric_limits<double>::infinity();
+        max_ = -std::numeric_limits<double>::infinity();
+    }
+
+  private:
+    std::size_t bucketOf(double value) const
+    {
+        int exponent;
+        double mantissa = std::frexp(value, &exponent);  // value = mantissa * 2^exponent, mantissa in [0.5, 1)
+        if (exponent < minExponent_)
+            return 0;
+        if (exponent > maxExponent_)
+            return counts_.size() - 1;
+
+        int sub = static_cast<int>((mantissa - 0.5) * 2 * subBuckets_);
+        return static_cast<std::size_t>(exponent - minExponent_) * subBuckets_ + std::min(sub, subBuckets_ - 1);
+    }
+
+    double bucketMidpoint(std::size_t index) const
+    {
+        int exponent = minExponent_ + static_cast<int>(index / subBuckets_);
+        double sub = static_cast<double>(index % subBuckets_);
+        double mantissa = 0.5 + (sub + 0.5) / (2.0 * subBuckets_);
+        return std::ldexp(mantissa, exponent);
+    }
+
+    int subBuckets_;
+    int minExponent_ = 0;
+    int maxExponent_ = 0;
+    std::vector<uint64_t> counts_;
+
+    uint64_t count_ = 0;
+    uint64_t nonPositive_ = 0;
+    double sum_ = 0;
+    double min_ = std::numeric_limits<double>::infinity();
+    double max_ = -std::numeric_limits<double>::infinity();
+};
+
+} // namespace simu5g
+
+#endif  // __SIMU5G_QUANTILESKETCH_H_
@@ -0,0 +1,65 @@
+#ifndef __SIMU5G_RTTESTIMATOR_H_
+#define __SIMU5G_RTTESTIMATOR_H_
+
+#include <cmath>
+
+namespace simu5g {
+
+/**
+ * RttEstimator
+ *
+ * Smoothed round-trip time of one (cell, MEC host) path, maintained from RTT samples
+ * with the estimator of TCP (RFC 6298):
+ *
+ *   rttvar = (1 - beta) * rttvar + beta * |srtt - sample|
+ *   srtt   = (1 - alpha) * srtt + alpha * sample
+ *
+ * The first sample sets srtt = sample and rttvar = sample / 2. Updates and reads are
+ * O(1) and the state is a few doubles, so one estimator per path is cheap to keep.
+ *
+ * The class does not depend on OMNeT++.
+ */
+class RttEstimator
+{
+  protected:
+    double srtt_ = 0.0;
+    double rttvar_ = 0.0;
+    double lastUpdate_ = 0.0;
+    unsigned long count_ = 0;
+
+  public:
+    /*
+     * Adds an RTT sample (in seconds) taken at the given time.
+     *
+     * @param alpha gain of the smoothed RTT
+     * @param beta gain of the RTT variation
+     */
+    void collect(double sample, double now, double alpha = 0.125, double beta = 0.25)
+    {
+        if (count_ == 0) {
+            srtt_ = sample;
+            rttvar_ = sample / 2;
+        }
+        else {
+            rttvar_ = (1 - beta) * rttvar_ + beta * std::fabs(srtt_ - sample);
+            srtt_ = (1 - alpha) * srtt_ + alpha * sample;
+        }
+        lastUpdate_ = now;
+        ++count_;
+    }
+
+    bool isValid() const { return count_ > 0; }
+    unsigned long getCount() const { return count_; }
+    double getSrtt() const { return srtt_; }
+    double getRttVar() const { return rttvar_; }
+    double getLastUpdate() const { return lastUpdate_; }
+
+    // srtt + k * rttvar, e.g. k = 4 gives the TCP retransmission timeout
+    double getEstimate(double k = 0.0) const { return srtt_ + k * rttvar_; }
+
+    void clear() { *this = RttEstimator(); }
+};
+
+} // namespace simu5g
+
+#endif  // __SIMU5G_RTTESTIMATOR_H_
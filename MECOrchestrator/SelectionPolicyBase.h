@@ -0,0 +1,50 @@
+//
+//                  Simu5G
+//
+// Authors: Giovanni Nardini, Giovanni Stea, Antonio Virdis (University of Pisa)
+//
+// This file is part of a software released under the license included in file
+// "license.pdf". Please read LICENSE and README files before using it.
+// The above files and the present reference are part of the software itself,
+// and cannot be removed from it.
+//
+
+#ifndef NODES_MEC_MECORCHESTRATOR_SELECTIONPOLICYBASE_H_
+#define NODES_MEC_MECORCHESTRATOR_SELECTIONPOLICYBASE_H_
+
+#include "nodes/mec/MECOrchestrator/MecOrchestrator.h"
+#include "nodes/mec/MECOrchestrator/ApplicationDescriptor/ApplicationDescriptor.h"
+
+namespace simu5g {
+
+class MecOrchestrator;
+
+class SelectionPolicyBase
+{
+    friend class MecOrchestrator;
+
+  protected:
+    MecOrchestrator *mecOrchestrator_ = nullptr;
+    virtual cModule *findBestMecHost(const ApplicationDescriptor&) = 0;
+
+    // called by the orchestrator when one of its parameters changes at run time,
+    // so that policies can refresh the values they cache (nullptr = all parameters)
+    virtual void handleParameterChange(const char *parname) {}
+
+    // called by the orchestrator when the metrics of the MEC host at the given registry
+    // index change (resources, NIC traffic, RTT), so that policies can drop what they
+    // derived from them (-1 = all hosts)
+    virtual void handleHostChange(int hostIndex) {}
+
+    // live set of the MEC hosts associated with the MEC system (owned by the orchestrator)
+    const MecHostRegistry& getMecHosts() const { return mecOrchestrator_->mecHostRegistry_; }
+
+  public:
+    SelectionPolicyBase(MecOrchestrator *mecOrchestrator) : mecOrchestrator_(mecOrchestrator) {}
+    virtual ~SelectionPolicyBase() {}
+};
+
+} //namespace
+
+#endif /* NODES_MEC_MECORCHESTRATOR_SELECTIONPOLICYBASE_H_ */
+
@@ -0,0 +1,173 @@
+#ifndef __SIMU5G_SLOTMAP_H_
+#define __SIMU5G_SLOTMAP_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace simu5g {
+
+/**
+ * SlotMap
+ *
+ * Associative container that hands out its own keys. Values are stored densely in a
+ * vector (erase moves the last value into the hole), and every key refers to a slot
+ * that points at the current position of its value. Freed slots are recycled through
+ * a free list.
+ *
+ * Keys are non-negative ints made of the slot index (low INDEX_BITS bits) and of the
+ * generation of the slot, which is bumped every time the slot is freed. A key that
+ * outlives its value is therefore not confused with the value that later reuses the
+ * slot: find() returns nullptr and isStale() returns true. Generations wrap around
+ * after 2^(31 - INDEX_BITS) reuses of the same slot.
+ *
+ * insert, erase and find are O(1); iteration walks the dense value vector (in no
+ * particular order).
+ *
+ * The class does not depend on OMNeT++.
+ */
+template <typename T>
+class SlotMap
+{
+  public:
+    static const int INVALID_ID = -1;
+    static const int INDEX_BITS = 20;
+    static const std::size_t MAX_SIZE = std::size_t(1) << INDEX_BITS;
+
+    typedef typename std::vector<T>::iterator iterator;
+    typedef typename std::vector<T>::const_iterator const_iterator;
+
+    /*
+     * @return the key that the next insert() will return (valid until the
+     *         map is modified)
+     */
+    int nextId() const
+    {
+        if (!freeList_.empty())
+            return makeId(freeList_.back(), slots_[freeList_.back()].generation);
+        if (slots_.size() >= MAX_SIZE)
+            return INVALID_ID;
+        return makeId(slots_.size(), 0);
+    }
+
+    // Stores value and returns its key. Throws std::length_error if the map is full.
+    int insert(T value)
+    {
+        uint32_t slot;
+        if (!freeList_.empty()) {
+            slot = freeList_.back();
+            freeList_.pop_back();
+        }
+        else {
+            if (slots_.size() >= MAX_SIZE)
+                throw std::length_error("SlotMap::insert - no free slots");
+            slot = slots_.size();
+            slots_.push_back(Slot());
+        }
+
+        slots_[slot].denseIndex = values_.size();
+        values_.push_back(std::move(value));
+        denseToSlot_.push_back(slot);
+        if (values_.size() > peakSize_)
+            peakSize_ = values_.size();
+
+        return makeId(slot, slots_[slot].generation);
+    }
+
+    // Removes the value of key. Returns false if the key is invalid or stale.
+    bool erase(int id)
+    {
+        if (!contains(id))
+            return false;
+
+        uint32_t slot = slotOf(id);
+        uint32_t index = slots_[slot].denseIndex;
+        uint32_t last = values_.size() - 1;
+        if (index != last) {
+            values_[index] = std::move(values_[last]);
+            denseToSlot_[index] = denseToSlot_[last];
+            slots_[denseToSlot_[index]].denseIndex = index;
+        }
+        values_.pop_back();
+        denseToSlot_.pop_back();
+
+        slots_[slot].denseIndex = FREE;
+        slots_[slot].generation = (slots_[slot].generation + 1) & GENERATION_MASK;
+        freeList_.push_back(slot);
+        return true;
+    }
+
+    T *find(int id) { return contains(id) ? &values_[slots_[slotOf(id)].denseIndex] : nullptr; }
+    const T *find(int id) const { return contains(id) ? &values_[slots_[slotOf(id)].denseIndex] : nullptr; }
+
+    bool contains(int id) const
+    {
+        if (id < 0 || slotOf(id) >= slots_.size())
+            return false;
+        const Slot& slot = slots_[slotOf(id)];
+        return slot.denseIndex != FREE && slot.generation == generationOf(id);
+    }
+
+    // true if key has been handed out by this map but its value is gone
+    bool isStale(int id) const
+    {
+        return id >= 0 && slotOf(id) < slots_.size() && !contains(id);
+    }
+
+    std::size_t size() const { return values_.size(); }
+    bool empty() const { return values_.empty(); }
+    std::size_t getPeakSize() const { return peakSize_; }
+
+    // Removes all the values; outstanding keys become stale
+    void clear()
+    {
+        while (!values_.empty())
+            erase(makeId(denseToSlot_.back(), slots_[denseToSlot_.back()].generation));
+    }
+
+    iterator begin() { return values_.begin(); }
+    iterator end() { return values_.end(); }
+    const_iterator begin() const { return values_.begin(); }
+    const_iterator end() const { return values_.end(); }
+
+    // key of the value at position index of the iteration order
+    int idAt(std::size_t index) const
+    {
+        uint32_t slot = denseToSlot_[index];
+        return makeId(slot, slots_[slot].generation);
+    }
+
+    // Bytes allocated by the container (memory owned by the values themselves excluded)
+    std::size_t memoryUsage() const
+    {
+        return sizeof(*this) + slots_.capacity() * sizeof(Slot) + values_.capacity() * sizeof(T)
+               + denseToSlot_.capacity() * sizeof(uint32_t) + freeList_.capacity() * sizeof(uint32_t);
+    }
+
+  private:
+    static const uint32_t FREE = UINT32_MAX;
+    static const uint32_t INDEX_MASK = (uint32_t(1) << INDEX_BITS) - 1;
+    static const uint32_t GENERATION_MASK = (uint32_t(1) << (31 - INDEX_BITS)) - 1;
+
+    struct Slot
+    {
+        uint32_t denseIndex = FREE;
+        uint32_t generation = 0;
+    };
+
+    static int makeId(uint32_t slot, uint32_t generation) { return static_cast<int>((generation << INDEX_BITS) | slot); }
+    static uint32_t slotOf(int id) { return static_cast<uint32_t>(id) & INDEX_MASK; }
+    static uint32_t generationOf(int id) { return static_cast<uint32_t>(id) >> INDEX_BITS; }
+
+    std::vector<Slot> slots_;
+    std::vector<T> values_;
+    std::vector<uint32_t> denseToSlot_;   // index-aligned with values_
+    std::vector<uint32_t> freeList_;
+    std::size_t peakSize_ = 0;
+};
+
+} // namespace simu5g
+
+#endif  // __SIMU5G_SLOTMAP_H_
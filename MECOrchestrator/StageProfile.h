@@ -0,0 +1,87 @@
+#ifndef __SIMU5G_STAGEPROFILE_H_
+#define __SIMU5G_STAGEPROFILE_H_
+
+#include <chrono>
+
+#include "nodes/mec/MECOrchestrator/QuantileSketch.h"
+
+// Compile with -DSIMU5G_STAGE_TIMING=0 to remove the stage timers entirely
+#ifndef SIMU5G_STAGE_TIMING
+#define SIMU5G_STAGE_TIMING 1
+#endif
+
+namespace simu5g {
+
+/**
+ * StageProfile
+ *
+ * Wall-clock (host CPU) time spent by the orchestrator in each stage of a request,
+ * as opposed to the simulated time. Each stage keeps a QuantileSketch of its
+ * durations in seconds, so count, total, percentiles and maximum are available at
+ * the end of the run at a fixed memory cost.
+ *
+ * Stages are timed with STAGE_TIMER(profile, stage), which declares a scoped
+ * timer covering the rest of the enclosing block. The timer reads
+ * std::chrono::steady_clock twice (a few tens of ns, vDSO-backed on Linux);
+ * unlike a raw rdtsc it does not need calibration and is safe across cores.
+ *
+ * The class does not depend on OMNeT++.
+ */
+class StageProfile
+{
+  public:
+    enum Stage
+    {
+        ONBOARD,        // parsing of an application package (onboardApplicationPackage)
+        SELECT,         // MEC host selection policy
+        RESOLVE,        // L3AddressResolver lookup of the UE address
+        INSTANTIATE,    // MecPlatformManager::instantiate[Emulated]MEApp
+        ACK,            // building and sending the CREATE_CONTEXT_APP ack
+        NUM_STAGES
+    };
+
+    static const char *getName(Stage stage)
+    {
+        static const char *names[NUM_STAGES] = { "onboard", "select", "resolve", "instantiate", "ack" };
+        return names[stage];
+    }
+
+    void collect(Stage stage, double seconds) { sketches_[stage].collect(seconds); }
+    const QuantileSketch& getSketch(Stage stage) const { return sketches_[stage]; }
+
+  private:
+    QuantileSketch sketches_[NUM_STAGES];
+};
+
+class ScopedStageTimer
+{
+  public:
+    ScopedStageTimer(StageProfile& profile, StageProfile::Stage stage)
+        : profile_(profile), stage_(stage), start_(std::chrono::steady_clock::now()) {}
+
+    ~ScopedStageTimer()
+    {
+        profile_.collect(stage_, std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count());
+    }
+
+    ScopedStageTimer(const ScopedStageTimer&) = delete;
+    ScopedStageTimer& operator=(const ScopedStageTimer&) = delete;
+
+  private:
+    StageProfile& profile_;
+    StageProfile::Stage stage_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace simu5g
+
+#if SIMU5G_STAGE_TIMING
+#define SIMU5G_STAGE_CONCAT_(a, b) a##b
+#define SIMU5G_STAGE_CONCAT(a, b) SIMU5G_STAGE_CONCAT_(a, b)
+#define STAGE_TIMER(profile, stage) \
+    ::simu5g::ScopedStageTimer SIMU5G_STAGE_CONCAT(stageTimer_, __LINE__)((profile), ::simu5g::StageProfile::stage)
+#else
+#define STAGE_TIMER(profile, stage) do {} while (0)
+#endif
+
+#endif  // __SIMU5G_STAGEPROFILE_H_
@@ -0,0 +1,122 @@
+#ifndef __SIMU5G_TRAFFICMETER_H_
+#define __SIMU5G_TRAFFICMETER_H_
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace simu5g {
+
+/**
+ * WindowedRateMeter
+ *
+ * Rate of a flow (e.g. bits sent by a NIC) over a sliding window ending at the current
+ * time. The window is split into a fixed number of buckets kept in a ring, so memory is
+ * bounded and the rate is a running sum divided by the window length. Reads and writes
+ * first retire the buckets that left the window, which is at most one pass over the
+ * ring and amortized O(1). The bucket being filled is included, so the rate covers
+ * between (window - window/numBuckets) and window of history.
+ *
+ * The class does not depend on OMNeT++.
+ */
+class WindowedRateMeter
+{
+  protected:
+    std::vector<double> buckets_;
+    double bucketLength_ = 0.1;
+    int64_t currentBucket_ = 0;      // absolute index of the bucket being filled
+    double sum_ = 0.0;               // sum of the buckets in the window
+
+  public:
+    WindowedRateMeter(double window = 1.0, int numBuckets = 10) { setWindow(window, numBuckets); }
+
+    // resets the meter
+    void setWindow(double window, int numBuckets)
+    {
+        buckets_.assign(std::max(numBuckets, 1), 0.0);
+        bucketLength_ = window / buckets_.size();
+        currentBucket_ = 0;
+        sum_ = 0.0;
+    }
+
+    void collect(double amount, double now)
+    {
+        advance(now);
+        buckets_[currentBucket_ % buckets_.size()] += amount;
+        sum_ += amount;
+    }
+
+    // amount per second over the window
+    double getRate(double now)
+    {
+        advance(now);
+        return sum_ / getWindow();
+    }
+
+    double getWindow() const { return bucketLength_ * buckets_.size(); }
+
+  protected:
+    void advance(double now)
+    {
+        int64_t bucket = (int64_t)std::floor(now / bucketLength_);
+        if (bucket <= currentBucket_)
+            return;
+
+        int64_t numBuckets = buckets_.size();
+        if (bucket - currentBucket_ >= numBuckets) {
+            std::fill(buckets_.begin(), buckets_.end(), 0.0);
+            sum_ = 0.0;
+        }
+        else {
+            for (int64_t b = currentBucket_ + 1; b <= bucket; ++b) {
+                double& slot = buckets_[b % numBuckets];
+                sum_ -= slot;
+                slot = 0.0;
+            }
+            sum_ = std::max(sum_, 0.0);   // rounding
+        }
+        currentBucket_ = bucket;
+    }
+};
+
+/**
+ * QueueGauge
+ *
+ * Current occupancy of a queue, maintained from its enqueue and dequeue (or drop)
+ * events, with the peak seen so far. O(1) updates and reads.
+ *
+ * The class does not depend on OMNeT++.
+ */
+class QueueGauge
+{
+  protected:
+    double bits_ = 0.0;
+    long packets_ = 0;
+    double peakBits_ = 0.0;
+
+  public:
+    void push(double bits)
+    {
+        bits_ += bits;
+        ++packets_;
+        peakBits_ = std::max(peakBits_, bits_);
+    }
+
+    // also for the packets dropped from the queue
+    void pop(double bits)
+    {
+        bits_ = std::max(bits_ - bits, 0.0);
+        packets_ = std::max(packets_ - 1, 0L);
+    }
+
+    double getBitLength() const { return bits_; }
+    long getLength() const { return packets_; }
+    double getPeakBitLength() const { return peakBits_; }
+
+    void clear() { *this = QueueGauge(); }
+};
+
+} // namespace simu5g
+
+#endif  // __SIMU5G_TRAFFICMETER_H_
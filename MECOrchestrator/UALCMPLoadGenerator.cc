@@ -0,0 +1,238 @@
+//
+//                  Simu5G
+//
+// Authors: Giovanni Nardini, Giovanni Stea, Antonio Virdis (University of Pisa)
+//
+// This file is part of a software released under the license included in file
+// "license.pdf". Please read LICENSE and README files before using it.
+// The above files and the present reference are part of the software itself,
+// and cannot be removed from it.
+//
+
+#include "nodes/mec/MECOrchestrator/UALCMPLoadGenerator.h"
+
+#include <cmath>
+#include <string>
+
+#include "nodes/mec/UALCMP/UALCMPMessages/UALCMPMessages_m.h"
+#include "nodes/mec/UALCMP/UALCMPMessages/UALCMPMessages_types.h"
+#include "nodes/mec/UALCMP/UALCMPMessages/CreateContextAppMessage.h"
+#include "nodes/mec/UALCMP/UALCMPMessages/CreateContextAppAckMessage.h"
+
+namespace simu5g {
+
+Define_Module(UALCMPLoadGenerator);
+
+UALCMPLoadGenerator::~UALCMPLoadGenerator()
+{
+    cancelAndDelete(arrivalTimer_);
+    cancelAndDelete(deletionTimer_);
+}
+
+void UALCMPLoadGenerator::initialize()
+{
+    const char *process = par("arrivalProcess");
+    if (!strcmp(process, "poisson"))
+        arrivalProcess_ = POISSON;
+    else if (!strcmp(process, "bursty"))
+        arrivalProcess_ = BURSTY;
+    else if (!strcmp(process, "diurnal"))
+        arrivalProcess_ = DIURNAL;
+    else
+        throw cRuntimeError("UALCMPLoadGenerator::initialize - unknown arrival process [%s]", process);
+
+    arrivalRate_ = par("arrivalRate");
+    if (arrivalRate_ <= 0)
+        throw cRuntimeError("UALCMPLoadGenerator::initialize - arrivalRate must be positive");
+    burstSize_ = par("burstSize");
+    if (burstSize_ < 1)
+        throw cRuntimeError("UALCMPLoadGenerator::initialize - burstSize must be at least 1");
+    burstSpacing_ = par("burstSpacing").doubleValue();
+    diurnalPeriod_ = par("diurnalPeriod");
+    diurnalAmplitude_ = par("diurnalAmplitude");
+    if (diurnalAmplitude_ < 0 || diurnalAmplitude_ > 1)
+        throw cRuntimeError("UALCMPLoadGenerator::initialize - diurnalAmplitude must be in [0, 1]");
+    stopTime_ = par("stopTime").doubleValue();
+    maxRequests_ = par("maxRequests");
+    appDId_ = par("appDId").stdstringValue();
+    ueIpAddress_ = par("ueIpAddress").stdstringValue();
+
+    createAckLatencySignal_ = registerSignal("createAckLatency");
+    deleteAckLatencySignal_ = registerSignal("deleteAckLatency");
+    createSuccessSignal_ = registerSignal("createSuccess");
+    activeContextsSignal_ = registerSignal("activeContexts");
+
+    arrivalTimer_ = new cMessage("arrivalTimer");
+    deletionTimer_ = new cMessage("deletionTimer");
+
+    wallClockStart_ = std::chrono::steady_clock::now();
+
+    simtime_t startTime = par("startTime").doubleValue();
+    simtime_t first = nextArrivalTime(startTime);  // the diurnal rate is taken at the right phase
+    if (stopTime_ < SIMTIME_ZERO || first <= stopTime_)
+        scheduleAt(first, arrivalTimer_);
+}
+
+void UALCMPLoadGenerator::handleMessage(cMessage *msg)
+{
+    if (msg == arrivalTimer_) {
+        sendCreateRequest();
+
+        bool exhausted = maxRequests_ >= 0 && createRequests_ >= maxRequests_;
+        simtime_t next = nextArrivalTime(simTime());
+        if (!exhausted && (stopTime_ < SIMTIME_ZERO || next <= stopTime_))
+            scheduleAt(next, arrivalTimer_);
+    }
+    else if (msg == deletionTimer_) {
+        // serve all the deletions due now
+        while (!deletions_.empty() && deletions_.top().first <= simTime()) {
+            int contextId = deletions_.top().second;
+            deletions_.pop();
+            sendDeleteRequest(contextId);
+        }
+        scheduleDeletionTimer();
+    }
+    else {
+        handleAck(msg);
+    }
+}
+
+simtime_t UALCMPLoadGenerator::nextArrivalTime(simtime_t now)
+{
+    switch (arrivalProcess_) {
+        case POISSON:
+            return now + exponential(1.0 / arrivalRate_);
+
+        case BURSTY:
+            if (remainingInBurst_ > 0) {
+                --remainingInBurst_;
+                return now + burstSpacing_;
+            }
+            // burst arrivals at arrivalRate/burstSize keep the mean request rate at arrivalRate
+            remainingInBurst_ = burstSize_ - 1;
+            return now + exponential(burstSize_ / arrivalRate_);
+
+        case DIURNAL: {
+            // thinning of a Poisson process at the peak rate
+            double peakRate = arrivalRate_ * (1 + diurnalAmplitude_);
+            double t = now.dbl();
+            while (true) {
+                t += exponential(1.0 / peakRate);
+                double rate = arrivalRate_ * (1 + diurnalAmplitude_ * std::sin(2 * M_PI * t / diurnalPeriod_));
+                if (uniform(0, 1) * peakRate <= rate)
+                    return t;
+            }
+        }
+    }
+    return now;
+}
+
+void UALCMPLoadGenerator::sendCreateRequest()
+{
+    unsigned int requestId = nextRequestId_++;
+
+    CreateContextAppMessage *request = new CreateContextAppMessage();
+    request->setType(CREATE_CONTEXT_APP);
+    request->setRequestId(requestId);
+    // a new device app id for every request, so that the orchestrator never finds a running instance
+    request->setDevAppId(std::to_string(nextDevAppId_++).c_str());
+    request->setAppDId(appDId_.c_str());
+    request->setOnboarded(true);
+    request->setUeIpAddress(ueIpAddress_.c_str());
+
+    pendingRequests_[requestId] = { simTime(), true };
+    ++createRequests_;
+
+    EV << "UALCMPLoadGenerator::sendCreateRequest - request id: " << requestId << endl;
+    send(request, "toOrchestrator");
+}
+
+void UALCMPLoadGenerator::sendDeleteRequest(int contextId)
+{
+    unsigned int requestId = nextRequestId_++;
+
+    DeleteContextAppMessage *request = new DeleteContextAppMessage();
+    request->setType(DELETE_CONTEXT_APP);
+    request->setRequestId(requestId);
+    request->setContextId(contextId);
+
+    pendingRequests_[requestId] = { simTime(), false };
+    ++deleteRequests_;
+    emit(activeContextsSignal_, --activeContexts_);
+
+    EV << "UALCMPLoadGenerator::sendDeleteRequest - request id: " << requestId << " contextId: " << contextId << endl;
+    send(request, "toOrchestrator");
+}
+
+void UALCMPLoadGenerator::handleAck(cMessage *msg)
+{
+    UALCMPMessage *ack = check_and_cast<UALCMPMessage *>(msg);
+
+    auto it = pendingRequests_.find(ack->getRequestId());
+    if (it == pendingRequests_.end()) {
+        EV_WARN << "UALCMPLoadGenerator::handleAck - ack for unknown request id " << ack->getRequestId() << endl;
+        delete msg;
+        return;
+    }
+    simtime_t latency = simTime() - it->second.sendTime;
+    pendingRequests_.erase(it);
+
+    if (!strcmp(ack->getType(), ACK_CREATE_CONTEXT_APP)) {
+        CreateContextAppAckMessage *createAck = check_and_cast<CreateContextAppAckMessage *>(msg);
+        ++createAcks_;
+        emit(createAckLatencySignal_, latency);
+        emit(createSuccessSignal_, createAck->getSuccess() ? 1 : 0);
+
+        if (createAck->getSuccess()) {
+            ++createSuccesses_;
+            emit(activeContextsSignal_, ++activeContexts_);
+            deletions_.push({ simTime() + par("holdingTime").doubleValue(), createAck->getContextId() });
+            scheduleDeletionTimer();
+        }
+    }
+    else if (!strcmp(ack->getType(), ACK_DELETE_CONTEXT_APP)) {
+        DeleteContextAppAckMessage *deleteAck = check_and_cast<DeleteContextAppAckMessage *>(msg);
+        ++deleteAcks_;
+        emit(deleteAckLatencySignal_, latency);
+        if (deleteAck->getSuccess())
+            ++deleteSuccesses_;
+    }
+    else {
+        throw cRuntimeError("UALCMPLoadGenerator::handleAck - unexpected message type [%s]", ack->getType());
+    }
+
+    delete msg;
+}
+
+void UALCMPLoadGenerator::scheduleDeletionTimer()
+{
+    if (deletions_.empty())
+        return;
+
+    simtime_t next = deletions_.top().first;
+    if (deletionTimer_->isScheduled()) {
+        if (deletionTimer_->getArrivalTime() <= next)
+            return;
+        cancelEvent(deletionTimer_);
+    }
+    scheduleAt(next, deletionTimer_);
+}
+
+void UALCMPLoadGenerator::finish()
+{
+    double wallClock = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallClockStart_).count();
+
+    recordScalar("createRequests", createRequests_);
+    recordScalar("createAcks", createAcks_);
+    recordScalar("createSuccessRate", createAcks_ > 0 ? (double)createSuccesses_ / createAcks_ : 0.0);
+    recordScalar("deleteRequests", deleteRequests_);
+    recordScalar("deleteAcks", deleteAcks_);
+    recordScalar("deleteSuccessRate", deleteAcks_ > 0 ? (double)deleteSuccesses_ / deleteAcks_ : 0.0);
+    recordScalar("unansweredRequests", pendingRequests_.size());
+
+    // admission throughput in host time (includes the whole simulation, not only the orchestrator)
+    recordScalar("wallClockTime", wallClock, "s");
+    recordScalar("wallClockAckRate", wallClock > 0 ? (createAcks_ + deleteAcks_) / wallClock : 0.0, "Hz");
+}
+
+} //namespace
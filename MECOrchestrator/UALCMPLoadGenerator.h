@@ -0,0 +1,106 @@
+//
+//                  Simu5G
+//
+// Authors: Giovanni Nardini, Giovanni Stea, Antonio Virdis (University of Pisa)
+//
+// This file is part of a software released under the license included in file
+// "license.pdf". Please read LICENSE and README files before using it.
+// The above files and the present reference are part of the software itself,
+// and cannot be removed from it.
+//
+
+#ifndef __UALCMPLOADGENERATOR_H_
+#define __UALCMPLOADGENERATOR_H_
+
+#include <chrono>
+#include <functional>
+#include <queue>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <omnetpp.h>
+
+namespace simu5g {
+
+using namespace omnetpp;
+
+//
+// UALCMPLoadGenerator
+//
+// Injects CREATE_CONTEXT_APP/DELETE_CONTEXT_APP requests into the MEC orchestrator in place
+// of the UALCMP and measures their ack latency and success rate. See the NED file.
+//
+// Deletions are kept in a min-heap ordered by time and served by a single timer, so that
+// the number of scheduled events does not grow with the number of active contexts.
+//
+class UALCMPLoadGenerator : public cSimpleModule
+{
+  protected:
+    enum ArrivalProcess { POISSON, BURSTY, DIURNAL };
+
+    struct PendingRequest
+    {
+        simtime_t sendTime;
+        bool isCreate;
+    };
+
+    // contexts waiting for their DELETE_CONTEXT_APP, earliest first
+    typedef std::pair<simtime_t, int> ScheduledDeletion;  // (time, contextId)
+    std::priority_queue<ScheduledDeletion, std::vector<ScheduledDeletion>, std::greater<ScheduledDeletion>> deletions_;
+
+    std::unordered_map<unsigned int, PendingRequest> pendingRequests_;  // key = request id
+
+    ArrivalProcess arrivalProcess_ = POISSON;
+    double arrivalRate_ = 0;
+    int burstSize_ = 1;
+    simtime_t burstSpacing_;
+    double diurnalPeriod_ = 0;
+    double diurnalAmplitude_ = 0;
+    simtime_t stopTime_;
+    long maxRequests_ = -1;
+    std::string appDId_;
+    std::string ueIpAddress_;
+
+    cMessage *arrivalTimer_ = nullptr;
+    cMessage *deletionTimer_ = nullptr;
+
+    unsigned int nextRequestId_ = 0;
+    int nextDevAppId_ = 0;
+    int remainingInBurst_ = 0;
+    long activeContexts_ = 0;
+
+    // counters recorded at finish
+    long createRequests_ = 0;
+    long createAcks_ = 0;
+    long createSuccesses_ = 0;
+    long deleteRequests_ = 0;
+    long deleteAcks_ = 0;
+    long deleteSuccesses_ = 0;
+    std::chrono::steady_clock::time_point wallClockStart_;
+
+    simsignal_t createAckLatencySignal_;
+    simsignal_t deleteAckLatencySignal_;
+    simsignal_t createSuccessSignal_;
+    simsignal_t activeContextsSignal_;
+
+  public:
+    ~UALCMPLoadGenerator() override;
+
+  protected:
+    void initialize() override;
+    void handleMessage(cMessage *msg) override;
+    void finish() override;
+
+    // time of the next CREATE_CONTEXT_APP request after the given time, according to the arrival process
+    simtime_t nextArrivalTime(simtime_t now);
+
+    void sendCreateRequest();
+    void sendDeleteRequest(int contextId);
+    void handleAck(cMessage *msg);
+    void scheduleDeletionTimer();
+};
+
+} //namespace
+
+#endif
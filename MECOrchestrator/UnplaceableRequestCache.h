@@ -0,0 +1,93 @@
+#ifndef __SIMU5G_UNPLACEABLEREQUESTCACHE_H_
+#define __SIMU5G_UNPLACEABLEREQUESTCACHE_H_
+
+#include <cstddef>
+#include <vector>
+
+namespace simu5g {
+
+/**
+ * UnplaceableRequestCache
+ *
+ * Resource tuples (ram, disk, cpu) that no MEC host can allocate, so that the requests
+ * repeating them fail without running a selection. A tuple also covers every request
+ * needing at least as much of each resource. Allocations only shrink the available
+ * resources, so the entries stay valid until resources are released or a host joins:
+ * the owner must clear() the cache on those events.
+ *
+ * The cache holds a few tuples (replaced round-robin when it is full), so lookups are
+ * a short linear scan.
+ *
+ * The class does not depend on OMNeT++.
+ */
+class UnplaceableRequestCache
+{
+  protected:
+    struct Entry
+    {
+        double ram, disk, cpu;
+
+        bool covers(double r, double d, double c) const { return ram <= r && disk <= d && cpu <= c; }
+    };
+
+    std::vector<Entry> entries_;
+    std::size_t capacity_ = 8;
+    std::size_t oldest_ = 0;         // next entry to replace when the cache is full
+
+  public:
+    UnplaceableRequestCache(std::size_t capacity = 8) : capacity_(capacity) {}
+
+    // 0 disables the cache
+    void setCapacity(std::size_t capacity)
+    {
+        capacity_ = capacity;
+        clear();
+    }
+
+    // whether a request with these resources is known to be unplaceable
+    bool contains(double ram, double disk, double cpu) const
+    {
+        for (const Entry& entry : entries_) {
+            if (entry.covers(ram, disk, cpu))
+                return true;
+        }
+        return false;
+    }
+
+    void add(double ram, double disk, double cpu)
+    {
+        if (capacity_ == 0 || contains(ram, disk, cpu))
+            return;
+
+        // drop the entries the new one covers
+        for (std::size_t i = 0; i < entries_.size(); ) {
+            if (Entry { ram, disk, cpu }.covers(entries_[i].ram, entries_[i].disk, entries_[i].cpu)) {
+                entries_[i] = entries_.back();
+                entries_.pop_back();
+            }
+            else {
+                ++i;
+            }
+        }
+
+        if (entries_.size() < capacity_) {
+            entries_.push_back({ ram, disk, cpu });
+        }
+        else {
+            oldest_ %= capacity_;
+            entries_[oldest_++] = { ram, disk, cpu };
+        }
+    }
+
+    void clear()
+    {
+        entries_.clear();
+        oldest_ = 0;
+    }
+
+    std::size_t size() const { return entries_.size(); }
+};
+
+} // namespace simu5g
+
+#endif  // __SIMU5G_UNPLACEABLEREQUESTCACHE_H_
@@ -0,0 +1,157 @@
+//
+// Standalone benchmark of the duplicate-instance check done by
+// MecOrchestrator::startMECApp on every CREATE_CONTEXT_APP.
+//
+// It compares the original linear scan over the context map with the
+// MecAppInstanceIndex lookup while the number of live contexts grows. Every
+// admission is a full steady-state step: duplicate check, insertion of the new
+// context and removal of the oldest one, so the number of live contexts stays
+// constant. Half of the requests hit an already running instance.
+//
+// The context map entry mirrors the fields of mecAppMapEntry that matter for
+// the check (and a similar footprint), so the benchmark does not need the
+// OMNeT++ kernel.
+//
+// Build and run:
+//   g++ -O3 -march=native -std=c++17 -I../MECOrchestrator MecAppAdmissionBench.cc -o MecAppAdmissionBench
+//   ./MecAppAdmissionBench
+//
+
+#include "MecAppInstanceIndex.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <deque>
+#include <map>
+#include <random>
+#include <string>
+
+using namespace simu5g;
+
+namespace {
+
+struct MockContext
+{
+    int contextId;
+    std::string appDId;
+    std::string mecAppName;
+    std::string mecAppInstanceId;
+    int mecUeAppID;
+    void *mecHost = nullptr;
+    void *vim = nullptr;
+    void *mecpm = nullptr;
+    void *reference = nullptr;
+};
+
+const char *appDIds[] = { "WAMECAPP", "MECWarningAlertApp", "MecRequestApp", "BgMecApp" };
+const int numAppDIds = sizeof(appDIds) / sizeof(appDIds[0]);
+
+class Admission
+{
+  public:
+    explicit Admission(bool useIndex) : useIndex_(useIndex) {}
+
+    // returns the context id of the running instance, or the new one
+    int admit(int ueAppID, const std::string& appDId)
+    {
+        int running = useIndex_ ? index_.find(ueAppID, appDId) : scan(ueAppID, appDId);
+        if (running != -1)
+            return running;
+        return add(ueAppID, appDId);
+    }
+
+    // adds a context without the duplicate check (used to prefill the map)
+    int add(int ueAppID, const std::string& appDId)
+    {
+
+        int contextId = nextContextId_++;
+        MockContext& ctx = contexts_[contextId];
+        ctx.contextId = contextId;
+        ctx.appDId = appDId;
+        ctx.mecUeAppID = ueAppID;
+        ctx.mecAppName = appDId;
+        ctx.mecAppInstanceId = "instance_" + std::to_string(contextId);
+        index_.insert(ueAppID, appDId, contextId);
+        order_.push_back(contextId);
+        return contextId;
+    }
+
+    void retireOldest()
+    {
+        int contextId = order_.front();
+        order_.pop_front();
+        auto it = contexts_.find(contextId);
+        index_.erase(it->second.mecUeAppID, it->second.appDId, contextId);
+        contexts_.erase(it);
+    }
+
+    std::size_t size() const { return contexts_.size(); }
+
+  private:
+    int scan(int ueAppID, const std::string& appDId) const
+    {
+        for (const auto& contextApp : contexts_) {
+            if (contextApp.second.mecUeAppID == ueAppID && contextApp.second.appDId == appDId)
+                return contextApp.first;
+        }
+        return -1;
+    }
+
+    bool useIndex_;
+    std::map<int, MockContext> contexts_;
+    MecAppInstanceIndex index_;
+    std::deque<int> order_;
+    int nextContextId_ = 0;
+};
+
+double nsPerAdmission(bool useIndex, std::size_t liveContexts, std::size_t iterations)
+{
+    Admission admission(useIndex);
+    int nextUe = 0;
+    while (admission.size() < liveContexts) {
+        admission.add(nextUe, appDIds[nextUe % numAppDIds]);
+        ++nextUe;
+    }
+
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> pick(0, 1);
+    volatile int sink = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        if (pick(rng)) {
+            // duplicate request of a live (recent) UE app
+            int ue = nextUe - 1 - static_cast<int>(i % liveContexts) / 2;
+            sink = admission.admit(ue, appDIds[ue % numAppDIds]);
+        }
+        else {
+            // new UE app: admit it and retire the oldest context
+            sink = admission.admit(nextUe, appDIds[nextUe % numAppDIds]);
+            ++nextUe;
+            admission.retireOldest();
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    (void)sink;
+
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+} // namespace
+
+int main()
+{
+    std::printf("%14s %16s %16s %10s\n", "live contexts", "scan ns/adm", "index ns/adm", "speedup");
+
+    for (std::size_t n : { 10, 100, 1000, 10000, 50000 }) {
+        std::size_t scanIterations = std::max<std::size_t>(200, 20000000 / n);
+        std::size_t indexIterations = 1000000;
+
+        double scan = nsPerAdmission(false, n, scanIterations);
+        double index = nsPerAdmission(true, n, indexIterations);
+
+        std::printf("%14zu %16.0f %16.0f %9.1fx\n", n, scan, index, scan / index);
+    }
+    return 0;
+}
@@ -0,0 +1,187 @@
+//
+// Standalone benchmark of the power-of-d-choices mode of LatencyAwareSelection
+// (selectionPolicy = "LatencyAwareSampled") against the exhaustive scan.
+//
+// A fleet of MEC hosts with fixed latencies and CPU capacities serves a stream of
+// app requests; every placed app allocates one CPU unit. The fleet starts at the
+// target load (apps spread at random) and an app departs for each arrival, so it
+// stays loaded. Both modes replay the same arrivals and departures:
+//
+//  - scan      : every host is scored with HostMetricSnapshot, as the policy does
+//                without sampling
+//  - d=2,4,8   : d distinct feasible hosts drawn at random (infeasible draws are
+//                redrawn, up to 4d draws) are scored with HostMetricSnapshot,
+//                normalized among themselves; the scan is the fallback
+//
+// and reports ns/decision, the mean latency and CPU utilization of the selected hosts
+// (placement quality and load balance) and the rejected requests. At high load the
+// draws of d=2 often miss the few hosts with room, and the fallback scans dominate.
+//
+// Build and run:
+//   g++ -O3 -march=native -std=c++17 -I../MECOrchestrator PowerOfDChoicesBench.cc -o PowerOfDChoicesBench
+//   ./PowerOfDChoicesBench
+//
+
+#include "HostMetricSnapshot.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+using namespace simu5g;
+
+namespace {
+
+struct MockHost
+{
+    double latency = 0.0;
+    int capacity = 0;       // CPU units
+    int used = 0;
+
+    bool isAllocable() const { return used < capacity; }
+    double cpu() const { return double(used) / capacity; }
+};
+
+struct Result
+{
+    double nsPerDecision = 0.0;
+    double meanLatency = 0.0;
+    double meanCpu = 0.0;       // utilization of the selected host, before the placement
+    long rejected = 0;
+};
+
+class Fleet
+{
+  public:
+    std::vector<MockHost> hosts;
+
+    Fleet(std::size_t n, unsigned long seed)
+    {
+        std::mt19937_64 rng(seed);
+        std::uniform_real_distribution<double> u(0.0, 1.0);
+        hosts.resize(n);
+        for (auto& host : hosts) {
+            host.latency = 0.001 + 0.099 * u(rng);
+            host.capacity = 8 + rng() % 25;
+        }
+    }
+
+    int capacity() const
+    {
+        int total = 0;
+        for (const auto& host : hosts)
+            total += host.capacity;
+        return total;
+    }
+};
+
+// Exhaustive scan, as LatencyAwareSelection without sampling
+int scanSelect(const Fleet& fleet, const HostMetricWeights& w, HostMetricSnapshot& snapshot)
+{
+    snapshot.reset(fleet.hosts.size());
+    for (const auto& host : fleet.hosts) {
+        bool feasible = host.isAllocable();
+        snapshot.add(host.latency, feasible ? host.cpu() : 1.0, 0.0, 0.0, feasible);
+    }
+    return snapshot.selectBest(w);
+}
+
+// Power of d choices, as LatencyAwareSelection::drawSample()
+int sampledSelect(const Fleet& fleet, const HostMetricWeights& w, int d, std::mt19937_64& rng,
+                  HostMetricSnapshot& sample, std::vector<int>& sampleHosts, HostMetricSnapshot& snapshot)
+{
+    sampleHosts.clear();
+    sample.reset(d);
+    const std::size_t n = fleet.hosts.size();
+    for (int draw = 0; draw < 4 * d && (int)sampleHosts.size() < d; draw++) {
+        int i = rng() % n;
+        const MockHost& host = fleet.hosts[i];
+        if (!host.isAllocable() || std::find(sampleHosts.begin(), sampleHosts.end(), i) != sampleHosts.end())
+            continue;
+        sampleHosts.push_back(i);
+        sample.add(host.latency, host.cpu(), 0.0, 0.0, true);
+    }
+
+    int best = sample.selectBest(w);
+    return best >= 0 ? sampleHosts[best] : scanSelect(fleet, w, snapshot);
+}
+
+Result run(std::size_t n, int d, double load, std::size_t decisions)
+{
+    Fleet fleet(n, 42);
+    HostMetricWeights w { 0.7, 0.3, 0.0, 0.0 };
+    HostMetricSnapshot snapshot, sample;
+    std::vector<int> sampleHosts;
+    std::mt19937_64 sampling(7), departures(11), warmup(13);
+    std::vector<int> placed;     // hosts of the running apps
+
+    // start at the target load, the apps spread at random over the hosts with room
+    const std::size_t target = std::size_t(load * fleet.capacity());
+    while (placed.size() < target) {
+        int i = warmup() % n;
+        if (fleet.hosts[i].isAllocable()) {
+            fleet.hosts[i].used++;
+            placed.push_back(i);
+        }
+    }
+
+    Result result;
+    double latencySum = 0.0, cpuSum = 0.0;
+    long accepted = 0;
+    for (std::size_t k = 0; k < decisions; ++k) {
+        // departure of a random running app
+        std::size_t j = departures() % placed.size();
+        fleet.hosts[placed[j]].used--;
+        placed[j] = placed.back();
+        placed.pop_back();
+
+        auto t0 = std::chrono::steady_clock::now();
+        int host = d > 0 ? sampledSelect(fleet, w, d, sampling, sample, sampleHosts, snapshot)
+                         : scanSelect(fleet, w, snapshot);
+        auto t1 = std::chrono::steady_clock::now();
+
+        result.nsPerDecision += std::chrono::duration<double, std::nano>(t1 - t0).count();
+        if (host < 0) {
+            ++result.rejected;
+            continue;
+        }
+        latencySum += fleet.hosts[host].latency;
+        cpuSum += fleet.hosts[host].cpu();
+        ++accepted;
+        fleet.hosts[host].used++;
+        placed.push_back(host);
+    }
+
+    result.nsPerDecision /= decisions;
+    result.meanLatency = accepted ? latencySum / accepted : 0.0;
+    result.meanCpu = accepted ? cpuSum / accepted : 0.0;
+    return result;
+}
+
+} // namespace
+
+int main()
+{
+    std::printf("%8s %5s %6s %14s %12s %8s %9s %9s\n", "hosts", "load", "mode", "ns/decision", "latency ms", "cpu",
+                "rejected", "speedup");
+
+    for (std::size_t n : { 100, 1000, 10000, 100000 }) {
+        for (double load : { 0.5, 0.9 }) {
+            std::size_t decisions = std::max<std::size_t>(200, 20000000 / n);
+            Result scan = run(n, 0, load, decisions);
+            std::printf("%8zu %5.1f %6s %14.0f %12.3f %8.2f %9ld %9s\n", n, load, "scan", scan.nsPerDecision,
+                        scan.meanLatency * 1e3, scan.meanCpu, scan.rejected, "");
+            for (int d : { 2, 4, 8 }) {
+                Result sampled = run(n, d, load, decisions);
+                char mode[8];
+                std::snprintf(mode, sizeof(mode), "d=%d", d);
+                std::printf("%8zu %5.1f %6s %14.0f %12.3f %8.2f %9ld %8.1fx\n", n, load, mode, sampled.nsPerDecision,
+                            sampled.meanLatency * 1e3, sampled.meanCpu, sampled.rejected,
+                            scan.nsPerDecision / sampled.nsPerDecision);
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,496 @@
+//
+// Standalone microbenchmark of the MEC host selection policies.
+//
+// It drives the SelectionPolicyBase implementations through the same interface the
+// orchestrator uses (one findBestMecHost() call per decision):
+//
+//  - LatencyAware       : LatencyAwareSelection<ModerateScenario>, the real
+//                         LatencyAwareScorer with its per-cell HostScoreIndex
+//  - LatencyAware-worst : LatencyAwareSelection<WorstScenario>, a full scan with a
+//                         random penalty per feasible host
+//  - LatencyAwareSampled: LatencyAwareSelection<ModerateScenario> with 2 sampled choices
+//  - AvailableResources : mirror of AvailableResourcesSelectionBased, the allocable host with
+//                         the most available CPU
+//  - AvailableRes+bits  : the same, visiting only the hosts of the availability
+//                         classes of the request (HostFeasibilityIndex)
+//  - MecService         : mirror of MecServiceSelectionBased, the first allocable host
+//                         whose service registry provides the required MEC service(s)
+//
+// The hosts come from a mock host-state provider that replaces the registry of
+// MecHostDescriptors and the VIM/ServiceRegistry/NIC modules behind them, so the
+// benchmark does not need the OMNeT++ kernel. As in the orchestrator, throughput and
+// queue length come from the WindowedRateMeter/QueueGauge of each host, fed with one
+// packet per decision (the host is reported to the policy as changed), and one host in
+// eight has a latency expression, resampled at every decision. The suite sweeps
+//
+//  - host count       : number of MEC hosts in the registry
+//  - fill ratio       : fraction of hosts that cannot allocate the request
+//  - descriptor size  : number of MEC services required by the app descriptor
+//
+// and reports ns/decision and heap allocations/decision (global operator new is
+// counted). Seeds are fixed, so runs are repeatable; use --csv to get a
+// machine-readable table to compare against a baseline. The LatencyAware weights
+// default to those of MecOrchestrator.ned (latency, cpu, throughput, queueLen).
+//
+// Build and run:
+//   g++ -O3 -march=native -std=c++17 -I../MECOrchestrator SelectionPolicyBench.cc -o SelectionPolicyBench
+//   ./SelectionPolicyBench [--csv] [--weights=0.7,0.3,0,0]
+//
+
+#include "HostFeasibilityIndex.h"
+#include "LatencyAwareScorer.h"
+#include "TrafficMeter.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace simu5g;
+
+//
+// Allocation counting
+//
+static std::atomic<unsigned long> allocations { 0 };
+
+void *operator new(std::size_t size)
+{
+    ++allocations;
+    if (void *p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept { std::free(p); }
+void operator delete(void *p, std::size_t) noexcept { std::free(p); }
+
+namespace {
+
+//
+// Mock host-state provider
+//
+struct MockResources
+{
+    double ram = 0, disk = 0, cpu = 0;
+};
+
+// Mirrors the VirtualisationInfrastructureManager queries used by the policies
+struct MockVim
+{
+    MockResources max;
+    MockResources allocated;
+
+    bool isAllocable(double ram, double disk, double cpu) const
+    {
+        return ram < max.ram - allocated.ram && disk < max.disk - allocated.disk && cpu < max.cpu - allocated.cpu;
+    }
+    double getUsedCpu() const { return allocated.cpu / max.cpu; }
+    MockResources getAvailableResources() const
+    {
+        return { max.ram - allocated.ram, max.disk - allocated.disk, max.cpu - allocated.cpu };
+    }
+};
+
+struct MockServiceInfo
+{
+    std::string name;
+    const std::string& getName() const { return name; }
+};
+
+struct MockServiceRegistry
+{
+    std::vector<MockServiceInfo> services;
+    const std::vector<MockServiceInfo> *getAvailableMecServices() const { return &services; }
+};
+
+// Mirrors MecHostDescriptor
+struct MockHost
+{
+    std::string name;
+    MockVim vim;
+    std::unique_ptr<MockServiceRegistry> serviceRegistry;
+    double latency = 0;           // as resolved from hostLatencies
+    double latencyJitter = 0;     // > 0: latency expression uniform(latency, latency + latencyJitter)
+    WindowedRateMeter txMeter;
+    WindowedRateMeter rxMeter;
+    QueueGauge queueGauge;
+    const char *getName() const { return name.c_str(); }
+};
+
+class MockHostProvider
+{
+  public:
+    std::vector<std::unique_ptr<MockHost>> hosts;
+    unsigned long version = 1;    // MecHostRegistry::getVersion(), the host set does not change
+    double now = 1.0;             // simulation time, s
+    std::mt19937_64 rng { 1 };    // RNGs of the orchestrator
+
+    int size() const { return hosts.size(); }
+    const MockHost& operator[](int i) const { return *hosts[i]; }
+    MockHost& operator[](int i) { return *hosts[i]; }
+
+    double uniform() { return std::uniform_real_distribution<double>(0.0, 1.0)(rng); }
+    int intRand(int n) { return std::uniform_int_distribution<int>(0, n - 1)(rng); }
+
+    // MecOrchestrator::sampleLatency()
+    double sampleLatency(int i)
+    {
+        const MockHost& host = *hosts[i];
+        return host.latencyJitter > 0 ? host.latency + host.latencyJitter * uniform() : host.latency;
+    }
+
+    // Advances the clock by 1ms and moves a packet through the NIC of a random host, as the
+    // traffic signals of the orchestrator do; returns the index of the host
+    int tick()
+    {
+        const double bits = 12000;
+        now += 0.001;
+        int i = intRand(size());
+        MockHost& host = *hosts[i];
+        host.rxMeter.collect(bits, now);
+        if (uniform() < 0.5) {
+            host.queueGauge.push(bits);
+        }
+        else if (host.queueGauge.getBitLength() >= bits) {
+            host.queueGauge.pop(bits);
+            host.txMeter.collect(bits, now);
+        }
+        return i;
+    }
+};
+
+struct MockAppDescriptor
+{
+    MockResources virtualResources;
+    std::vector<std::string> servicesRequired;
+    const MockResources& getVirtualResources() const { return virtualResources; }
+    const std::vector<std::string>& getAppServicesRequired() const { return servicesRequired; }
+};
+
+const int numServiceNames = 32;
+
+std::string serviceName(int i)
+{
+    static const char *base[] = { "LocationService", "RNIService", "WLANInformationService", "BandwidthManagementService" };
+    return std::string(base[i % 4]) + "_" + std::to_string(i / 4);
+}
+
+//
+// Policies (mirror SelectionPolicyBase: findBestMecHost() returns a host or nothing)
+//
+class PolicyBase
+{
+  public:
+    explicit PolicyBase(MockHostProvider& hosts) : hosts_(hosts) {}
+    virtual ~PolicyBase() {}
+    virtual const MockHost *findBestMecHost(const MockAppDescriptor&) = 0;
+    virtual void handleHostChange(int hostIndex) {}
+
+  protected:
+    MockHostProvider& hosts_;
+};
+
+// View of the mock hosts for LatencyAwareScorer, as LatencyAwareSelection::OrchestratorHosts
+// is of the registry of the orchestrator
+template <bool RandomPenalty>
+struct MockHosts
+{
+    static constexpr bool randomPenalty = RandomPenalty;
+
+    MockHostProvider& provider;
+    const MockResources& resources;
+
+    int size() const { return provider.size(); }
+    unsigned long getVersion() const { return provider.version; }
+    int getCell() const { return -1; }
+    bool isVolatile(int i) const { return provider[i].latencyJitter > 0; }
+
+    double getLatency(int i) const { return provider.sampleLatency(i); }
+    double getCpu(int i) const { return provider[i].vim.getUsedCpu(); }
+    double getThroughput(int i) const { return provider[i].txMeter.getRate(provider.now) + provider[i].rxMeter.getRate(provider.now); }
+    double getQueueLength(int i) const { return provider[i].queueGauge.getBitLength(); }
+
+    bool isFeasible(int i) const { return provider[i].vim.isAllocable(resources.ram, resources.disk, resources.cpu); }
+
+    // WorstScenario::drawPenalty() (ModerateScenario: 1.0)
+    double drawPenalty() const { return RandomPenalty ? 1.5 + 0.5 * provider.uniform() : 1.0; }
+    int drawHost(int n) const { return provider.intRand(n); }
+};
+
+// LatencyAwareSelection<ModerateScenario> (RandomPenalty = false) or <WorstScenario>
+template <bool RandomPenalty>
+class LatencyAwarePolicy : public PolicyBase
+{
+  public:
+    LatencyAwarePolicy(MockHostProvider& hosts, const HostMetricWeights& weights, int numChoices = 0)
+        : PolicyBase(hosts), scorer(numChoices)
+    {
+        scorer.setWeights(weights);
+    }
+
+    const MockHost *findBestMecHost(const MockAppDescriptor& appDesc) override
+    {
+        MockResources resources = appDesc.getVirtualResources();
+        MockHosts<RandomPenalty> hosts { hosts_, resources };
+
+        const std::vector<int> *subset = nullptr;
+        if (scorer.getNumChoices() > 0)
+            subset = scorer.drawSample(hosts);
+
+        double bestScore, latency = 0.0;
+        int best = scorer.select(hosts, subset, bestScore, latency);
+        return best < 0 ? nullptr : &hosts_[best];
+    }
+
+    void handleHostChange(int hostIndex) override { scorer.invalidate(hostIndex); }
+
+  private:
+    LatencyAwareScorer<MockHosts<RandomPenalty>> scorer;
+};
+
+// AvailableResourcesSelectionBased
+class AvailableResourcesPolicy : public PolicyBase
+{
+  public:
+    using PolicyBase::PolicyBase;
+
+    const MockHost *findBestMecHost(const MockAppDescriptor& appDesc) override
+    {
+        const MockHost *bestHost = nullptr;
+        double maxCpuSpeed = -1;
+        MockResources resources = appDesc.getVirtualResources();
+
+        for (int i = 0; i < hosts_.size(); i++) {
+            const MockHost& host = hosts_[i];
+            if (!host.vim.isAllocable(resources.ram, resources.disk, resources.cpu))
+                continue;
+            double cpuSpeed = host.vim.getAvailableResources().cpu;
+            if (cpuSpeed > maxCpuSpeed) {
+                bestHost = &host;
+                maxCpuSpeed = cpuSpeed;
+            }
+        }
+        return bestHost;
+    }
+};
+
+// AvailableResourcesSelectionBased on the candidate hosts of the orchestrator
+class AvailableResourcesBitsetPolicy : public PolicyBase
+{
+  public:
+    explicit AvailableResourcesBitsetPolicy(MockHostProvider& hosts) : PolicyBase(hosts)
+    {
+        // the orchestrator keeps the index up to date with the published host states
+        for (int i = 0; i < hosts_.size(); i++) {
+            MockResources available = hosts_[i].vim.getAvailableResources();
+            feasibility.addHost();
+            feasibility.setAvailable(i, available.ram, available.disk, available.cpu);
+        }
+    }
+
+    const MockHost *findBestMecHost(const MockAppDescriptor& appDesc) override
+    {
+        const MockHost *bestHost = nullptr;
+        double maxCpuSpeed = -1;
+        const MockResources& resources = appDesc.getVirtualResources();
+        const HostFeasibilityIndex::HostSet& candidates = feasibility.findHosts(resources.ram, resources.disk, resources.cpu);
+
+        candidates.forEach([&](int i) {
+            const MockHost& host = hosts_[i];
+            double cpuSpeed = host.vim.getAvailableResources().cpu;
+            if (cpuSpeed > maxCpuSpeed) {
+                bestHost = &host;
+                maxCpuSpeed = cpuSpeed;
+            }
+        });
+        return bestHost;
+    }
+
+  private:
+    HostFeasibilityIndex feasibility;
+};
+
+// MecServiceSelectionBased
+class MecServicePolicy : public PolicyBase
+{
+  public:
+    using PolicyBase::PolicyBase;
+
+    const MockHost *findBestMecHost(const MockAppDescriptor& appDesc) override
+    {
+        MockResources resources = appDesc.getVirtualResources();
+        const std::vector<std::string>& required = appDesc.getAppServicesRequired();
+
+        for (int i = 0; i < hosts_.size(); i++) {
+            const MockHost& host = hosts_[i];
+            if (!host.vim.isAllocable(resources.ram, resources.disk, resources.cpu))
+                continue;
+            if (!host.serviceRegistry)
+                continue;
+
+            const std::vector<MockServiceInfo> *services = host.serviceRegistry->getAvailableMecServices();
+            bool providesAll = true;
+            for (const auto& serviceName : required) {
+                bool found = false;
+                for (const auto& service : *services) {
+                    if (service.getName() == serviceName) {
+                        found = true;
+                        break;
+                    }
+                }
+                if (!found) {
+                    providesAll = false;
+                    break;
+                }
+            }
+            if (providesAll)
+                return &host;
+        }
+        return nullptr;
+    }
+};
+
+//
+// Scenario generation
+//
+MockHostProvider makeHosts(int numHosts, double fillRatio, std::mt19937_64& rng)
+{
+    std::uniform_real_distribution<double> u(0.0, 1.0);
+    MockHostProvider provider;
+    for (int i = 0; i < numHosts; ++i) {
+        auto host = std::make_unique<MockHost>();
+        host->name = "mecHost" + std::to_string(i + 1);
+        host->vim.max = { 32768, 1e6, 150000 };
+        bool full = u(rng) < fillRatio;
+        double load = full ? 1.0 : 0.9 * u(rng);
+        host->vim.allocated = { load * host->vim.max.ram, load * host->vim.max.disk, load * host->vim.max.cpu };
+        host->latency = 0.001 + 0.099 * u(rng);
+        if (i % 8 == 7)
+            host->latencyJitter = 0.01;
+
+        // traffic of the last traffic meter window
+        host->txMeter.collect(1e9 * u(rng), 0.5);
+        host->rxMeter.collect(1e9 * u(rng), 0.5);
+        host->queueGauge.push(1e6 * u(rng));
+
+        // every host offers a random half of the service catalogue
+        host->serviceRegistry = std::make_unique<MockServiceRegistry>();
+        for (int s = 0; s < numServiceNames; ++s) {
+            if (u(rng) < 0.5)
+                host->serviceRegistry->services.push_back({ serviceName(s) });
+        }
+        provider.hosts.push_back(std::move(host));
+    }
+    return provider;
+}
+
+MockAppDescriptor makeDescriptor(int numServices, std::mt19937_64& rng)
+{
+    MockAppDescriptor desc;
+    desc.virtualResources = { 100, 100, 1000 };
+    std::uniform_int_distribution<int> pick(0, numServiceNames - 1);
+    for (int s = 0; s < numServices; ++s)
+        desc.servicesRequired.push_back(serviceName(pick(rng)));
+    return desc;
+}
+
+struct Result
+{
+    double nsPerDecision;
+    double allocationsPerDecision;
+};
+
+Result run(PolicyBase& policy, MockHostProvider& hosts, const MockAppDescriptor& desc, std::size_t iterations)
+{
+    policy.findBestMecHost(desc);  // warm-up, lets the policies size their buffers
+
+    volatile const MockHost *sink = nullptr;
+    unsigned long allocationsBefore = allocations.load();
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < iterations; ++i) {
+        sink = policy.findBestMecHost(desc);
+        policy.handleHostChange(hosts.tick());
+    }
+    auto end = std::chrono::steady_clock::now();
+    unsigned long allocated = allocations.load() - allocationsBefore;
+    (void)sink;
+
+    return { std::chrono::duration<double, std::nano>(end - start).count() / iterations,
+             static_cast<double>(allocated) / iterations };
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+    bool csv = false;
+    HostMetricWeights weights { 0.7, 0.3, 0.0, 0.0 };  // defaults of MecOrchestrator.ned
+    for (int i = 1; i < argc; ++i) {
+        if (!strcmp(argv[i], "--csv")) {
+            csv = true;
+        }
+        else if (std::sscanf(argv[i], "--weights=%lf,%lf,%lf,%lf",
+                             &weights.latency, &weights.cpu, &weights.throughput, &weights.queueLen) != 4) {
+            std::fprintf(stderr, "usage: %s [--csv] [--weights=latency,cpu,throughput,queueLen]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    if (csv)
+        std::printf("policy,hosts,fill,services,ns_per_decision,allocs_per_decision\n");
+    else
+        std::printf("%-20s %8s %6s %9s %14s %14s\n", "policy", "hosts", "fill", "services", "ns/decision", "allocs/dec");
+
+    for (int numHosts : { 2, 16, 128, 1024, 8192 }) {
+        for (double fill : { 0.0, 0.5, 0.9 }) {
+            for (int numServices : { 1, 4, 16 }) {
+                std::mt19937_64 rng(numHosts * 1000 + static_cast<int>(fill * 100) + numServices);
+                MockHostProvider hosts = makeHosts(numHosts, fill, rng);
+                MockAppDescriptor desc = makeDescriptor(numServices, rng);
+                std::size_t iterations = std::max<std::size_t>(50, 4000000 / numHosts);
+
+                LatencyAwarePolicy<false> latencyAware(hosts, weights);
+                LatencyAwarePolicy<true> latencyAwareWorst(hosts, weights);
+                LatencyAwarePolicy<false> latencyAwareSampled(hosts, weights, 2);
+                AvailableResourcesPolicy availableResources(hosts);
+                AvailableResourcesBitsetPolicy availableResourcesBitset(hosts);
+                MecServicePolicy mecService(hosts);
+                std::pair<const char *, PolicyBase *> policies[] = {
+                    { "LatencyAware", &latencyAware },
+                    { "LatencyAware-worst", &latencyAwareWorst },
+                    { "LatencyAwareSampled", &latencyAwareSampled },
+                    { "AvailableResources", &availableResources },
+                    { "AvailableRes+bits", &availableResourcesBitset },
+                    { "MecService", &mecService },
+                };
+
+                // the candidate hosts must give the same selection as the full scan
+                if (availableResources.findBestMecHost(desc) != availableResourcesBitset.findBestMecHost(desc)) {
+                    std::printf("selection mismatch at %d hosts, fill %.2f\n", numHosts, fill);
+                    return 1;
+                }
+
+                for (auto& policy : policies) {
+                    // only MecService looks at the required services
+                    if (numServices != 1 && policy.second != &mecService)
+                        continue;
+
+                    Result r = run(*policy.second, hosts, desc, iterations);
+                    if (csv)
+                        std::printf("%s,%d,%.2f,%d,%.1f,%.3f\n", policy.first, numHosts, fill, numServices,
+                                    r.nsPerDecision, r.allocationsPerDecision);
+                    else
+                        std::printf("%-20s %8d %6.2f %9d %14.1f %14.3f\n", policy.first, numHosts, fill, numServices,
+                                    r.nsPerDecision, r.allocationsPerDecision);
+                }
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,282 @@
+#!/usr/bin/env python3
+#
+# Scenario generator for multi-MEC simulations at scale.
+#
+# Emits a NED network with N gNBs, M MEC hosts and a UE vector, modelled on
+# simu5g.simulations.NR.mec.multiMecHost.MultiMecHost, and an ini file with a
+# [Config <name>] section (extending MultiMec) that configures it:
+#
+#  - gNBs on a square grid (interSiteDistance apart), X2 links in a ring
+#  - MEC hosts spread over the same area, each one serving the gNBs it is the
+#    nearest MEC host of (bsList)
+#  - per-host maxCpuSpeed/maxRam drawn from the given ranges
+#  - a LocationService on a configurable share of the MEC hosts
+#  - per-host latency: the delay of the link between the MEC host and the UPF,
+#    drawn from [minLatency, maxLatency], and the same value in the
+#    hostLatencies table of the orchestrator
+#  - mecOrchestrator.mecHostList with all the MEC hosts
+#  - U UEs with random initial positions over the area
+#
+# Only the Python standard library is needed. The output is deterministic for
+# a given --seed.
+#
+# Usage:
+#   python3 tools/generate_scenario.py --gnbs 16 --mec-hosts 100 --ues 2000 \
+#       --name LargeMec --out-dir ModerateCase
+#
+# then add "include LargeMec.ini" at the end of omnetpp.ini (after [Config MultiMec])
+# and copy LargeMec.ned next to MultiMecHost.ned (same package).
+#
+
+import argparse
+import math
+import os
+import random
+import sys
+
+
+def grid_positions(count, spacing):
+    """Positions of count nodes on a grid as square as possible, first node at (spacing/2, spacing/2)."""
+    cols = math.ceil(math.sqrt(count))
+    return [((i % cols + 0.5) * spacing, (i // cols + 0.5) * spacing) for i in range(count)]
+
+
+def area_of(positions, spacing):
+    max_x = max(p[0] for p in positions) + spacing / 2
+    max_y = max(p[1] for p in positions) + spacing / 2
+    return max_x, max_y
+
+
+def nearest(point, candidates):
+    return min(range(len(candidates)),
+               key=lambda i: (candidates[i][0] - point[0]) ** 2 + (candidates[i][1] - point[1]) ** 2)
+
+
+class Scenario:
+    def __init__(self, args):
+        self.args = args
+        self.rng = random.Random(args.seed)
+
+        self.gnbs = ["gnb%d" % (i + 1) for i in range(args.gnbs)]
+        self.hosts = ["mecHost%d" % (i + 1) for i in range(args.mec_hosts)]
+
+        self.gnb_pos = grid_positions(args.gnbs, args.inter_site_distance)
+        self.area = area_of(self.gnb_pos, args.inter_site_distance)
+
+        # MEC hosts on their own grid stretched over the area covered by the gNBs
+        cols = math.ceil(math.sqrt(args.mec_hosts))
+        rows = math.ceil(args.mec_hosts / cols)
+        self.host_pos = [(((i % cols) + 0.5) * self.area[0] / cols, ((i // cols) + 0.5) * self.area[1] / rows)
+                         for i in range(args.mec_hosts)]
+
+        # every gNB is served by its nearest MEC host; a host without gNBs gets its nearest gNB
+        self.bs_list = [[] for _ in self.hosts]
+        for g, pos in enumerate(self.gnb_pos):
+            self.bs_list[nearest(pos, self.host_pos)].append(self.gnbs[g])
+        for h, pos in enumerate(self.host_pos):
+            if not self.bs_list[h]:
+                self.bs_list[h].append(self.gnbs[nearest(pos, self.gnb_pos)])
+
+        self.cpu = [self.rng.randint(args.min_cpu, args.max_cpu) for _ in self.hosts]
+        self.ram = [self.rng.choice(args.ram_choices) for _ in self.hosts]
+        self.latency = [round(self.rng.uniform(args.min_latency, args.max_latency), 3) for _ in self.hosts]
+        self.has_service = [self.rng.random() < args.service_ratio for _ in self.hosts]
+
+        # X2 ring: list of (gnb a, gate index on a, gnb b, gate index on b)
+        self.x2_links = []
+        x2_gates = [0] * args.gnbs
+        pairs = []
+        if args.gnbs == 2:
+            pairs = [(0, 1)]
+        elif args.gnbs > 2:
+            pairs = [(i, (i + 1) % args.gnbs) for i in range(args.gnbs)]
+        for a, b in pairs:
+            self.x2_links.append((a, x2_gates[a], b, x2_gates[b]))
+            x2_gates[a] += 1
+            x2_gates[b] += 1
+        self.x2_gates = x2_gates
+
+    # ------------------------------------------------------------------ NED
+    def ned(self):
+        a = self.args
+        out = []
+        out.append("//")
+        out.append("// Generated by tools/generate_scenario.py: %d gNBs, %d MEC hosts, up to %d UEs (seed %d)."
+                   % (a.gnbs, a.mec_hosts, a.ues, a.seed))
+        out.append("// Modelled on MultiMecHost; configure it with [Config %s]." % a.name)
+        out.append("//")
+        out.append("")
+        out.append("package %s;" % a.package)
+        out.append("")
+        out.append("import inet.networklayer.configurator.ipv4.Ipv4NetworkConfigurator;")
+        out.append("import inet.networklayer.ipv4.RoutingTableRecorder;")
+        out.append("import inet.node.ethernet.Eth10G;")
+        out.append("import inet.node.inet.Router;")
+        out.append("import inet.node.inet.StandardHost;")
+        out.append("import inet.visualizer.common.IntegratedMultiVisualizer;")
+        out.append("import simu5g.common.binder.Binder;")
+        out.append("import simu5g.common.carrierAggregation.CarrierAggregation;")
+        out.append("import simu5g.nodes.NR.gNodeB;")
+        out.append("import simu5g.nodes.NR.NRUe;")
+        out.append("import simu5g.nodes.Upf;")
+        out.append("import simu5g.nodes.mec.MECHost;")
+        out.append("import simu5g.nodes.mec.MECOrchestrator.MecOrchestrator;")
+        out.append("import simu5g.nodes.mec.UALCMP.UALCMP;")
+        out.append("import simu5g.world.radio.LteChannelControl;")
+        out.append("")
+        out.append("network %s" % a.name)
+        out.append("{")
+        out.append("    parameters:")
+        out.append("        int numUe = default(%d);" % a.ues)
+        out.append('        @display("bgb=%d,%d");' % (math.ceil(self.area[0]), math.ceil(self.area[1])))
+        out.append("")
+        out.append("    submodules:")
+        out.append("        channelControl: LteChannelControl { @display(\"p=50,25;is=s\"); }")
+        out.append("        routingRecorder: RoutingTableRecorder { @display(\"p=50,75;is=s\"); }")
+        out.append("        configurator: Ipv4NetworkConfigurator { @display(\"p=50,125\"); }")
+        out.append("        binder: Binder { @display(\"p=50,175;is=s\"); }")
+        out.append("        carrierAggregation: CarrierAggregation { @display(\"p=50,225;is=s\"); }")
+        out.append("        visualizer: IntegratedMultiVisualizer { @display(\"p=50,275;is=s\"); }")
+        out.append("        server: StandardHost { @display(\"p=150,50;is=n;i=device/server\"); }")
+        out.append("        router: Router { @display(\"p=250,50;i=device/smallrouter\"); }")
+        out.append("        upf: Upf { @display(\"p=350,50\"); }")
+        out.append("        iUpf: Upf { @display(\"p=450,50\"); }")
+        out.append("        ualcmp: UALCMP { @display(\"p=250,125;i=device/smallrouter\"); }")
+        out.append("        mecOrchestrator: MecOrchestrator { @display(\"p=150,125;is=m\"); }")
+        for g, (x, y) in zip(self.gnbs, self.gnb_pos):
+            out.append("        %s: gNodeB { @display(\"p=%d,%d;is=vl\"); }" % (g, x, y))
+        for h, (x, y) in zip(self.hosts, self.host_pos):
+            out.append("        %s: MECHost { @display(\"p=%d,%d;is=l\"); }" % (h, x, y))
+        out.append("        ue[numUe]: NRUe { @display(\"p=%d,%d\"); }" % (self.area[0] / 2, self.area[1] / 2))
+        out.append("")
+        out.append("    connections allowunconnected:")
+        out.append("        server.pppg++ <--> Eth10G <--> router.pppg++;")
+        out.append("        router.pppg++ <--> Eth10G <--> upf.filterGate;")
+        out.append("        upf.pppg++ <--> Eth10G <--> iUpf.pppg++;")
+        out.append("        ualcmp.ppp++ <--> Eth10G <--> router.pppg++;")
+        out.append("        ualcmp.toMecOrchestrator --> mecOrchestrator.fromUALCMP;")
+        out.append("        ualcmp.fromMecOrchestrator <-- mecOrchestrator.toUALCMP;")
+        out.append("")
+        for g in self.gnbs:
+            out.append("        iUpf.pppg++ <--> Eth10G <--> %s.ppp;" % g)
+        out.append("")
+        for a_, _, b_, _ in self.x2_links:
+            out.append("        %s.x2++ <--> Eth10G <--> %s.x2++;" % (self.gnbs[a_], self.gnbs[b_]))
+        out.append("")
+        out.append("        // the delay of the MEC host link is the latency of the host")
+        for h, latency in zip(self.hosts, self.latency):
+            out.append("        %s.ppp++ <--> Eth10G { delay = %gms; } <--> iUpf.pppg++;" % (h, latency * 1000))
+        out.append("}")
+        return "\n".join(out) + "\n"
+
+    # ------------------------------------------------------------------ ini
+    def ini(self):
+        a = self.args
+        out = []
+        out.append("#------------------------------------#")
+        out.append("# Config %s" % a.name)
+        out.append("#")
+        out.append("# Generated by tools/generate_scenario.py --gnbs %d --mec-hosts %d --ues %d --seed %d"
+                   % (a.gnbs, a.mec_hosts, a.ues, a.seed))
+        out.append("# Include this file after [Config MultiMec].")
+        out.append("#")
+        out.append("[Config %s]" % a.name)
+        out.append("extends = MultiMec")
+        out.append("network = %s.%s" % (a.package, a.name))
+        out.append("")
+        out.append("############# Floorplan parameters ################")
+        out.append("**.mobility.constraintAreaMinX = 0m")
+        out.append("**.mobility.constraintAreaMinY = 0m")
+        out.append("**.mobility.constraintAreaMaxX = %dm" % math.ceil(self.area[0]))
+        out.append("**.mobility.constraintAreaMaxY = %dm" % math.ceil(self.area[1]))
+        out.append("")
+        out.append("############### BS position #################")
+        for g, (x, y) in zip(self.gnbs, self.gnb_pos):
+            out.append("*.%s.mobility.initialX = %dm" % (g, x))
+            out.append("*.%s.mobility.initialY = %dm" % (g, y))
+        out.append("")
+        out.append("############### X2 configuration #################")
+        for g, n in zip(self.gnbs, self.x2_gates):
+            out.append("*.%s.numX2Apps = %d" % (g, n))
+        app_index = [0] * a.gnbs
+        for ga, ia, gb, ib in self.x2_links:
+            out.append('*.%s.x2App[%d].client.connectAddress = "%s%%x2ppp%d"' % (self.gnbs[ga], app_index[ga], self.gnbs[gb], ib))
+            app_index[ga] += 1
+            out.append('*.%s.x2App[%d].client.connectAddress = "%s%%x2ppp%d"' % (self.gnbs[gb], app_index[gb], self.gnbs[ga], ia))
+            app_index[gb] += 1
+        out.append("")
+        out.append("############## UE configuration ##################")
+        out.append("*.numUe = ${numUEs=%s}" % ", ".join(str(u) for u in sorted(set(a.ue_sweep + [a.ues]))))
+        out.append("*.ue[*].mobility.initialX = uniform(0m, %dm)" % math.ceil(self.area[0]))
+        out.append("*.ue[*].mobility.initialY = uniform(0m, %dm)" % math.ceil(self.area[1]))
+        out.append("*.ue[*].mobility.initialMovementHeading = uniform(0deg, 360deg)")
+        out.append("")
+        out.append("############ MEC Configuration ############")
+        for h, cpu, ram, bs in zip(self.hosts, self.cpu, self.ram, self.bs_list):
+            out.append("*.%s.maxCpuSpeed = %d" % (h, cpu))
+            out.append("*.%s.maxRam = %dGB" % (h, ram))
+            out.append('*.%s.bsList = [%s]' % (h, ", ".join('"%s"' % g for g in bs)))
+        out.append("")
+        out.append("# MEC Services")
+        for h, service in zip(self.hosts, self.has_service):
+            out.append("*.%s.mecPlatform.numMecServices = %d" % (h, 1 if service else 0))
+            if service:
+                out.append('*.%s.mecPlatform.mecService[0].typename = "LocationService"' % h)
+                out.append('*.%s.mecPlatform.mecService[0].localAddress = "%s.virtualisationInfrastructure"' % (h, h))
+                out.append("*.%s.mecPlatform.mecService[0].localPort = 10020" % h)
+            out.append('*.%s.mecPlatform.serviceRegistry.localAddress = "%s.virtualisationInfrastructure"' % (h, h))
+            out.append("*.%s.mecPlatform.serviceRegistry.localPort = 10021" % h)
+        out.append("")
+        out.append("# MEC Orchestrator configuration")
+        out.append("*.mecOrchestrator.mecHostList = [%s]" % ", ".join('"%s"' % h for h in self.hosts))
+        entries = ['"%s": %gms' % (h, latency * 1000) for h, latency in zip(self.hosts, self.latency)]
+        out.append("*.mecOrchestrator.hostLatencies = { \\\n    %s }" % ", \\\n    ".join(entries))
+        return "\n".join(out) + "\n"
+
+
+def parse_args(argv):
+    p = argparse.ArgumentParser(description="Generate a NED network and an ini section for N gNBs, M MEC hosts and U UEs.")
+    p.add_argument("--gnbs", type=int, required=True, help="number of gNBs (N)")
+    p.add_argument("--mec-hosts", type=int, required=True, help="number of MEC hosts (M)")
+    p.add_argument("--ues", type=int, required=True, help="number of UEs (U)")
+    p.add_argument("--ue-sweep", type=int, nargs="*", default=[], help="additional UE counts for the ${numUEs} iteration")
+    p.add_argument("--name", default="ScaledMultiMec", help="name of the network and of the ini config")
+    p.add_argument("--package", default="simu5g.simulations.NR.mec.multiMecHost", help="NED package of the network")
+    p.add_argument("--out-dir", default=".", help="where <name>.ned and <name>.ini are written")
+    p.add_argument("--seed", type=int, default=1)
+    p.add_argument("--inter-site-distance", type=float, default=500.0, help="distance between gNBs, in m")
+    p.add_argument("--min-cpu", type=int, default=500, help="lowest maxCpuSpeed of a MEC host")
+    p.add_argument("--max-cpu", type=int, default=400000, help="highest maxCpuSpeed of a MEC host")
+    p.add_argument("--ram-choices", type=int, nargs="+", default=[8, 16, 32, 64], help="maxRam values of the MEC hosts, in GB")
+    p.add_argument("--min-latency", type=float, default=0.002, help="lowest MEC host latency, in s")
+    p.add_argument("--max-latency", type=float, default=0.040, help="highest MEC host latency, in s")
+    p.add_argument("--service-ratio", type=float, default=0.5, help="share of the MEC hosts that run a LocationService")
+    args = p.parse_args(argv)
+
+    if args.gnbs < 1 or args.mec_hosts < 1 or args.ues < 0:
+        p.error("at least one gNB and one MEC host are needed")
+    if args.min_cpu > args.max_cpu or args.min_latency > args.max_latency:
+        p.error("empty cpu or latency range")
+    if not 0.0 <= args.service_ratio <= 1.0:
+        p.error("--service-ratio must be in [0, 1]")
+    return args
+
+
+def main(argv):
+    args = parse_args(argv)
+    scenario = Scenario(args)
+
+    os.makedirs(args.out_dir, exist_ok=True)
+    ned_path = os.path.join(args.out_dir, args.name + ".ned")
+    ini_path = os.path.join(args.out_dir, args.name + ".ini")
+    with open(ned_path, "w") as f:
+        f.write(scenario.ned())
+    with open(ini_path, "w") as f:
+        f.write(scenario.ini())
+
+    print("wrote %s and %s (%d gNBs, %d MEC hosts, %d UEs)" % (ned_path, ini_path, args.gnbs, args.mec_hosts, args.ues))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv[1:]))